@@ -3,6 +3,8 @@
 #include <corecrt_math_defines.h>
 #include <string>
 #include <cassert>
+#include <cstdint>
+#include <limits>
 
 namespace Coaxial {
 	//   , /
@@ -17,31 +19,175 @@ namespace Coaxial {
 	//:      1,
 	//               (  )
 
+	//     
+	//        (evaluate)
+	enum class error : std::uint8_t {
+		//  
+		none = 0,
+		//    0
+		frequency,
+		//       1
+		epsilon,
+		//      0
+		tanDelta,
+		//    0
+		sigma,
+		//     
+		diameters,
+		//     0
+		innerDiameter,
+		//     0
+		electricStrength,
+		//     0
+		wavelength,
+		//     0
+		impedance,
+		//    0
+		voltage,
+		//    0
+		power,
+		//       
+		bounds,
+		//      0
+		length,
+		//     0
+		outerDiameter
+	};
+
+	//   :  error::x   (1 << (x - 1))
+	using errorMask = std::uint16_t;
+
+	// ,   
+	//code -  
+	constexpr errorMask errorBit(error const code) noexcept {
+		return code == error::none ? errorMask(0) : errorMask(1u << (static_cast<unsigned>(code) - 1u));
+	}
+
+	// (  )    
+	//mask -    
+	error firstError(errorMask const mask) noexcept {
+		if (mask == 0)
+			return error::none;
+		unsigned code = 1;
+		while ((mask & (1u << (code - 1u))) == 0)
+			++code;
+		return static_cast<error>(code);
+	}
+
+	//    
+	//    ,      
+	//code -  
+	wchar_t const* message(error const code) noexcept {
+		switch (code) {
+		case error::frequency:
+			return L"    0";
+		case error::epsilon:
+			return L"       1";
+		case error::tanDelta:
+			return L"      0";
+		case error::sigma:
+			return L"    0";
+		case error::diameters:
+			return L"     ";
+		case error::innerDiameter:
+			return L"     0";
+		case error::electricStrength:
+			return L"     0";
+		case error::wavelength:
+			return L"     0";
+		case error::impedance:
+			return L"     0";
+		case error::voltage:
+			return L"    0";
+		case error::power:
+			return L"    0";
+		case error::bounds:
+			return L"       ";
+		case error::length:
+			return L"      0";
+		case error::outerDiameter:
+			return L"     0";
+		default:
+			return L"";
+		}
+	}
+
 	//         (wchar_t - 2- )
 	class exception final {
-		//   
+		//   (error::none,    )
+		error code_;
+		//    (,    )
 		std::wstring description_;
 	public:
 		//
 		//description - rvalue-     
-		exception(std::wstring&& description) :description_(std::move(description)) {}
+		exception(std::wstring&& description) :code_(error::none), description_(std::move(description)) {}
+		//    (    )
+		//code -   
+		exception(error const code) noexcept :code_(code) {}
 		//
 		~exception() {}
 
+		//  
+		error code()const noexcept {
+			return code_;
+		}
+
 		//     (  C-)
 		wchar_t const* what()const noexcept {
-			return description_.c_str();
+			return code_ == error::none ? description_.c_str() : message(code_);
+		}
+	};
+
+	//      ( std::expected)
+	//T -  
+	template<typename T>
+	struct expected {
+		// ( ,  errors != 0)
+		T value;
+		//  
+		errorMask errors;
+
+		//  
+		explicit operator bool()const noexcept {
+			return errors == 0;
+		}
+		//  
+		error code()const noexcept {
+			return firstError(errors);
 		}
 	};
 
+	//      
+	//     (0 -  )
+	//d -    , 
+	//D -   , 
+	//frequency -   , 
+	//sigma -  , /
+	//epsilon -   
+	//Ep -  , /
+	//tanDelta -     
+	template<typename Real>
+	errorMask violations(Real const d, Real const D, Real const frequency, Real const sigma,
+		Real const epsilon, Real const Ep, Real const tanDelta) noexcept {
+		return errorMask(
+			(errorMask(frequency <= Real(0)) * errorBit(error::frequency)) |
+			(errorMask(epsilon < Real(1)) * errorBit(error::epsilon)) |
+			(errorMask(tanDelta <= Real(0)) * errorBit(error::tanDelta)) |
+			(errorMask(sigma <= Real(0)) * errorBit(error::sigma)) |
+			(errorMask(D <= d) * errorBit(error::diameters)) |
+			(errorMask(d <= Real(0)) * errorBit(error::innerDiameter)) |
+			(errorMask(Ep <= Real(0)) * errorBit(error::electricStrength)));
+	}
+
 	//      ( )
 	//frequency -   , 
 	//epsilon -   
 	double wavelengthInTheLine(double const frequency, double const epsilon) {
 		if (frequency <= 0.0)
-			throw exception(L"    0");
+			throw exception(error::frequency);
 		if (epsilon < 1.0)
-			throw exception(L"       1");
+			throw exception(error::epsilon);
 
 		//   
 		double const lambda_0 = lightSpeed / frequency;
@@ -92,7 +238,7 @@ namespace Coaxial {
 	//epsilon -   
 	double phaseSpeed(double const epsilon) {
 		if (epsilon < 1.0)
-			throw exception(L"       1");
+			throw exception(error::epsilon);
 
 		double const result = lightSpeed / sqrt(epsilon);
 		return result;
@@ -137,7 +283,7 @@ namespace Coaxial {
 	//epsilon -   
 	double characteristicResistance(double const epsilon) {
 		if (epsilon < 1.0)
-			throw exception(L"       1");
+			throw exception(error::epsilon);
 
 		double const result = 120.0 * M_PI * sqrt(1.0 / epsilon);
 		return result;
@@ -182,9 +328,9 @@ namespace Coaxial {
 	//wavelength -  , 
 	double attenuationCoefficientInDielectric(double const tanDelta, double const wavelength) {
 		if (tanDelta <= 0.0)
-			throw exception(L"      0");
+			throw exception(error::tanDelta);
 		if (wavelength <= 0.0)
-			throw exception(L"     0");
+			throw exception(error::wavelength);
 		
 		// , /
 		double const alpha_d = tanDelta * M_PI / wavelength;
@@ -239,15 +385,15 @@ namespace Coaxial {
 	//D     d
 	double attenuationCoefficientInMetal(double const frequency, double const sigma, double const epsilon, double const d, double const D) {
 		if (frequency <= 0.0)
-			throw exception(L"    0");
+			throw exception(error::frequency);
 		if (sigma <= 0.0)
-			throw exception(L"    0");
+			throw exception(error::sigma);
 		if (epsilon < 1.0)
-			throw exception(L"       1");
+			throw exception(error::epsilon);
 		if (D <= d)
-			throw exception(L"     ");
+			throw exception(error::diameters);
 		if (d <= 0)
-			throw exception(L"     0");
+			throw exception(error::innerDiameter);
 
 		// , /
 		double const omega = 2.0 * M_PI * frequency;
@@ -316,17 +462,17 @@ namespace Coaxial {
 	//D     d
 	double totalAttenuationCoefficient(double const tanDelta, double const frequency, double const sigma, double const epsilon, double const d, double const D) {
 		if (tanDelta <= 0.0)
-			throw exception(L"      0");
+			throw exception(error::tanDelta);
 		if (frequency <= 0.0)
-			throw exception(L"    0");
+			throw exception(error::frequency);
 		if (sigma <= 0.0)
-			throw exception(L"    0");
+			throw exception(error::sigma);
 		if (epsilon < 1.0)
-			throw exception(L"       1");
+			throw exception(error::epsilon);
 		if (D <= d)
-			throw exception(L"     ");
+			throw exception(error::diameters);
 		if (d <= 0)
-			throw exception(L"     0");
+			throw exception(error::innerDiameter);
 
 		//    
 		double const wavelength = wavelengthInTheLine(frequency, epsilon);
@@ -390,11 +536,11 @@ namespace Coaxial {
 	//D     d
 	double waveResistance(double const epsilon, double const d, double const D) {
 		if (epsilon < 1.0)
-			throw exception(L"       1");
+			throw exception(error::epsilon);
 		if (D <= d)
-			throw exception(L"     ");
+			throw exception(error::diameters);
 		if (d <= 0)
-			throw exception(L"     0");
+			throw exception(error::innerDiameter);
 
 		double const result = 60.0 * sqrt(1.0 / epsilon) * log(D / d);
 		return result;
@@ -448,11 +594,11 @@ namespace Coaxial {
 	//D     d
 	double peakVoltage(double const Ep, double const d, double const D) {
 		if (Ep <= 0)
-			throw exception(L"     0");
+			throw exception(error::electricStrength);
 		if (D <= d)
-			throw exception(L"     ");
+			throw exception(error::diameters);
 		if (d <= 0)
-			throw exception(L"     0");
+			throw exception(error::innerDiameter);
 
 		double const result = Ep * (D / 2.0) * log(D / d);
 		return result;
@@ -491,13 +637,13 @@ namespace Coaxial {
 	//D     d
 	double peakPower(double const epsilon, double const Ep, double const d, double const D) {
 		if (epsilon < 1.0)
-			throw exception(L"       1");
+			throw exception(error::epsilon);
 		if (Ep <= 0)
-			throw exception(L"     0");
+			throw exception(error::electricStrength);
 		if (D <= d)
-			throw exception(L"     ");
+			throw exception(error::diameters);
 		if (d <= 0)
-			throw exception(L"     0");
+			throw exception(error::innerDiameter);
 
 		// 
 		double const u = peakVoltage(Ep, d, D);
@@ -528,4 +674,258 @@ namespace Coaxial {
 		}
 	} test_PeakPower;
 #endif // _DEBUG
+
+
+
+	//      TE11
+	// lambda_c = pi * (D + d) / 2 * sqrt(epsilon) (    ),  -  ;
+	//         TEM  TE11,    TEM 
+	//epsilon -   
+	//d -    , 
+	//D -   , 
+	//D     d
+	double cutoffFrequency(double const epsilon, double const d, double const D) {
+		if (epsilon < 1.0)
+			throw exception(error::epsilon);
+		if (D <= d)
+			throw exception(error::diameters);
+		if (d <= 0)
+			throw exception(error::innerDiameter);
+
+		double const result = 2.0 * lightSpeed / (M_PI * (D + d) * sqrt(epsilon));
+		return result;
+	}
+
+#ifdef _DEBUG
+	//      TE11
+	class testCutoffFrequency {
+		//     (  )
+		//epsilon -   
+		//d -    , 
+		//D -   , 
+		//result -  
+		//precision -   
+		static void checkEqual(double const epsilon, double const d, double const D, double result, double precision) {
+			double const value = cutoffFrequency(epsilon, d, D);
+			double const delta = abs(value - result);
+			assert(delta <= precision);
+		}
+	public:
+		testCutoffFrequency() {
+			test();
+		}
+
+		static void test()noexcept {
+			checkEqual(2.08, 2.1e-3, 7.3e-3, 1.4078e10, 1e6);
+			checkEqual(2.08, 1.5e-3, 4.86e-3, 2.0807e10, 1e6);
+		}
+	} test_CutoffFrequency;
+#endif // _DEBUG
+
+
+	//    
+	//Real -      (float, double, long double)
+	template<typename Real>
+	struct basicDesign {
+		//   , 
+		Real d;
+		//  , 
+		Real D;
+		//  , 
+		Real frequency;
+		// , /
+		Real sigma;
+		//  
+		Real epsilon;
+		// , /
+		Real Ep;
+		//    
+		Real tanDelta;
+	};
+
+	//     
+	//Real -      (float, double, long double)
+	template<typename Real>
+	struct basicResults {
+		//   , 
+		Real wavelength;
+		// , /
+		Real phaseSpeed;
+		// , 
+		Real characteristicResistance;
+		//  , /
+		Real dielectricAttenuation;
+		//  , /
+		Real metalAttenuation;
+		// , /
+		Real totalAttenuation;
+		// , 
+		Real waveResistance;
+		// , 
+		Real peakVoltage;
+		// , 
+		Real peakPower;
+	};
+
+	//  -  
+	using Design = basicDesign<double>;
+	using Results = basicResults<double>;
+
+	// :        long double
+	//  d = 0.1..10 , D/d = 1.05..20, f = 1 ..100 , epsilon = 1..10
+	//(     ,    )
+	//                               float      double
+	//  wavelength                  1.5e-7     1.8e-16
+	//  phaseSpeed                  9.2e-8     7.2e-17
+	//  characteristicResistance    8.2e-8     1.5e-16
+	//  dielectricAttenuation       1.9e-7     3.3e-16
+	//  metalAttenuation            1.2e-6     2.4e-15
+	//  totalAttenuation            1.2e-6     2.4e-15
+	//  waveResistance              1.1e-6     2.1e-15
+	//  peakVoltage                 1.0e-6     2.1e-15
+	//  peakPower                   1.6e-6     3.3e-15
+	//  -  D/d -> 1,    log(D/d)   1 / log(D/d).
+	//  - long double ( MSVC long double   double,     GCC/Clang  x86)
+
+	//        
+	//     (0 -  )
+	//design -  
+	template<typename Real>
+	errorMask violations(basicDesign<Real> const& design) noexcept {
+		return violations(design.d, design.D, design.frequency, design.sigma, design.epsilon, design.Ep, design.tanDelta);
+	}
+
+	//    -        
+	//  (, fast::math)     sqrt  log
+	struct exactMath {
+		// 
+		//x - 
+		template<typename Real>
+		static Real sqrt(Real const x) noexcept {
+			using std::sqrt;
+			return sqrt(x);
+		}
+		// 
+		//x - 
+		template<typename Real>
+		static Real log(Real const x) noexcept {
+			using std::log;
+			return log(x);
+		}
+	};
+
+	//         
+	//      (NaN  ),   
+	//    Real,   float      
+	//Math -    (sqrt, log)
+	//design -  
+	template<typename Math = exactMath, typename Real>
+	basicResults<Real> evaluateUnchecked(basicDesign<Real> const& design) noexcept {
+		Real const pi = static_cast<Real>(M_PI);
+		Real const c = static_cast<Real>(lightSpeed);
+		Real const decibels = static_cast<Real>(8.68);
+
+		// 
+		Real const sqrtEpsilon = Math::sqrt(design.epsilon);
+		Real const logRatio = Math::log(design.D / design.d);
+
+		basicResults<Real> result;
+		result.wavelength = c / design.frequency / sqrtEpsilon;
+		result.phaseSpeed = c / sqrtEpsilon;
+		result.characteristicResistance = Real(120) * pi / sqrtEpsilon;
+		result.dielectricAttenuation = design.tanDelta * pi / result.wavelength * decibels;
+
+		// , /
+		Real const omega = Real(2) * pi * design.frequency;
+		//  , 
+		Real const R_superficial = Math::sqrt((omega * static_cast<Real>(magneticConstant)) / (Real(2) * design.sigma));
+		result.metalAttenuation = sqrtEpsilon * (R_superficial / design.d + R_superficial / design.D) / (Real(120) * pi * logRatio) * decibels;
+		result.totalAttenuation = result.dielectricAttenuation + result.metalAttenuation;
+
+		result.waveResistance = Real(60) * logRatio / sqrtEpsilon;
+		result.peakVoltage = design.Ep * (design.D / Real(2)) * logRatio;
+		result.peakPower = (result.peakVoltage * result.peakVoltage / Real(120)) * Math::sqrt(design.epsilon / logRatio);
+		return result;
+	}
+
+	//     
+	//    , sqrt(epsilon)  log(D/d)    
+	//(     -     )
+	//Math -    (sqrt, log)
+	//design -  
+	template<typename Math = exactMath, typename Real>
+	basicResults<Real> evaluate(basicDesign<Real> const& design) {
+		errorMask const mask = violations(design);
+		if (mask != 0)
+			throw exception(firstError(mask));
+		return evaluateUnchecked<Math>(design);
+	}
+
+	//    
+	//    ,  :     ,
+	//      message(result.code())   
+	//Math -    (sqrt, log)
+	//design -  
+	template<typename Math = exactMath, typename Real>
+	expected<basicResults<Real>> tryEvaluate(basicDesign<Real> const& design) noexcept {
+		expected<basicResults<Real>> result;
+		result.errors = violations(design);
+		result.value = evaluateUnchecked<Math>(design);
+		return result;
+	}
+
+#ifdef _DEBUG
+	//     
+	class testEvaluate {
+		//      
+		//value -   
+		//expected -   
+		static void checkClose(double value, double expected) {
+			double const delta = abs(value - expected);
+			assert(delta <= 1e-12 * abs(expected));
+		}
+	public:
+		testEvaluate() {
+			test();
+		}
+
+		static void test() {
+			Design const design{ 2.1e-3, 7.3e-3, 1e10, 6.1e7, 2.08, 2.5e7, 2.5e-4 };
+			Results const result = evaluate(design);
+
+			checkClose(result.wavelength, wavelengthInTheLine(design.frequency, design.epsilon));
+			checkClose(result.phaseSpeed, phaseSpeed(design.epsilon));
+			checkClose(result.characteristicResistance, characteristicResistance(design.epsilon));
+			checkClose(result.dielectricAttenuation, attenuationCoefficientInDielectric(design.tanDelta, result.wavelength));
+			checkClose(result.metalAttenuation, attenuationCoefficientInMetal(design.frequency, design.sigma, design.epsilon, design.d, design.D));
+			checkClose(result.totalAttenuation, totalAttenuationCoefficient(design.tanDelta, design.frequency, design.sigma, design.epsilon, design.d, design.D));
+			checkClose(result.waveResistance, waveResistance(design.epsilon, design.d, design.D));
+			checkClose(result.peakVoltage, peakVoltage(design.Ep, design.d, design.D));
+			checkClose(result.peakPower, peakPower(design.epsilon, design.Ep, design.d, design.D));
+
+			// :      ,  -  
+			Design const bad{ 7.3e-3, 2.1e-3, 1e10, 6.1e7, 0.5, 2.5e7, 2.5e-4 };
+			expected<Results> const tried = tryEvaluate(bad);
+			assert(!tried);
+			assert(tried.errors == (errorBit(error::epsilon) | errorBit(error::diameters)));
+			assert(tried.code() == error::epsilon);
+			assert(tryEvaluate(design));
+
+			error thrown = error::none;
+			try {
+				evaluate(bad);
+			}
+			catch (exception const& e) {
+				thrown = e.code();
+			}
+			assert(thrown == error::epsilon);
+
+			// :       
+			basicResults<float> const single = evaluate(basicDesign<float>{ 2.1e-3f, 7.3e-3f, 1e10f, 6.1e7f, 2.08f, 2.5e7f, 2.5e-4f });
+			assert(abs(single.totalAttenuation - result.totalAttenuation) <= 1e-5 * result.totalAttenuation);
+			assert(abs(single.waveResistance - result.waveResistance) <= 1e-5 * result.waveResistance);
+			assert(abs(single.peakPower - result.peakPower) <= 1e-5 * result.peakPower);
+		}
+	} test_Evaluate;
+#endif // _DEBUG
 }
\ No newline at end of file
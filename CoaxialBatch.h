@@ -0,0 +1,337 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialSpan.h"
+
+// (  )    Coaxial.h
+//    (structure of arrays):     ,
+//i-       .
+//       ,     
+//     ,    (MSVC /O2 -  SVML, GCC/Clang -  -O3 -fno-math-errno).
+//  compute:   2*10^7       x64 (AVX2)      .
+//  TE11          (sqrt(epsilon) -    ;
+//  ,    ),         .
+//            (    ).
+//     : float            
+//( - .   Coaxial.h   basicResults).
+
+namespace Coaxial {
+	namespace batch {
+		//  ,    
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicInputs {
+			//   , 
+			span<Real const> d;
+			//  , 
+			span<Real const> D;
+			//  , 
+			span<Real const> frequency;
+			// , /
+			span<Real const> sigma;
+			//  
+			span<Real const> epsilon;
+			// , /
+			span<Real const> Ep;
+			//    
+			span<Real const> tanDelta;
+		};
+
+		// ,     ,    
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicOutputs {
+			//   , 
+			span<Real> wavelength;
+			// , /
+			span<Real> phaseSpeed;
+			// , 
+			span<Real> characteristicResistance;
+			//  , /
+			span<Real> dielectricAttenuation;
+			//  , /
+			span<Real> metalAttenuation;
+			// , /
+			span<Real> totalAttenuation;
+			// , 
+			span<Real> waveResistance;
+			// , 
+			span<Real> peakVoltage;
+			// , 
+			span<Real> peakPower;
+			//   TE11,  ( :  -  )
+			span<Real> cutoffFrequency;
+			// : 1,     TE11,  0 ( :  -  )
+			span<std::uint8_t> singleMode;
+		};
+
+		//  -  
+		using Inputs = basicInputs<double>;
+		using Outputs = basicOutputs<double>;
+
+		//    
+		//     
+		template<typename Real>
+		std::size_t rows(basicInputs<Real> const& in) {
+			std::size_t const n = in.d.size();
+			if (in.D.size() != n || in.frequency.size() != n || in.sigma.size() != n ||
+				in.epsilon.size() != n || in.Ep.size() != n || in.tanDelta.size() != n)
+				throw exception(L"      ");
+			return n;
+		}
+
+		//       
+		//       (0 -  )
+		//   
+		//in -   
+		//masks -   (   )
+		template<typename Real>
+		std::size_t violations(basicInputs<Real> const& in, span<errorMask> const masks) {
+			std::size_t const n = rows(in);
+			if (masks.size() != n)
+				throw exception(L"      ,    ");
+
+			std::size_t invalid = 0;
+			for (std::size_t i = 0; i < n; ++i) {
+				errorMask const mask = Coaxial::violations(in.d[i], in.D[i], in.frequency[i], in.sigma[i], in.epsilon[i], in.Ep[i], in.tanDelta[i]);
+				masks[i] = mask;
+				invalid += (mask != 0);
+			}
+			return invalid;
+		}
+
+		//    
+		//         ,    
+		template<typename Real>
+		void validate(basicInputs<Real> const& in) {
+			std::size_t const n = rows(in);
+
+			//   :       
+			errorMask any = 0;
+			for (std::size_t i = 0; i < n; ++i)
+				any |= Coaxial::violations(in.d[i], in.D[i], in.frequency[i], in.sigma[i], in.epsilon[i], in.Ep[i], in.tanDelta[i]);
+			if (any == 0)
+				return;
+
+			//       
+			for (std::size_t i = 0; i < n; ++i) {
+				errorMask const mask = Coaxial::violations(in.d[i], in.D[i], in.frequency[i], in.sigma[i], in.epsilon[i], in.Ep[i], in.tanDelta[i]);
+				if (mask != 0)
+					throw exception(firstError(mask));
+			}
+		}
+
+		namespace detail {
+			//   
+			//    __restrict:       ,
+			//   16        
+			//Modes -        ( cutoffFrequency  singleMode  )
+			template<typename Math, bool Modes, typename Real>
+			void computeRows(std::size_t const n, Real const* __restrict d, Real const* __restrict D, Real const* __restrict frequency,
+				Real const* __restrict sigma, Real const* __restrict epsilon, Real const* __restrict Ep, Real const* __restrict tanDelta,
+				Real* __restrict wavelength, Real* __restrict phaseSpeed, Real* __restrict characteristicResistance,
+				Real* __restrict dielectricAttenuation, Real* __restrict metalAttenuation, Real* __restrict totalAttenuation,
+				Real* __restrict waveResistance, Real* __restrict peakVoltage, Real* __restrict peakPower,
+				Real* __restrict cutoffFrequency, std::uint8_t* __restrict singleMode) noexcept {
+				//   Real,    float    double
+				Real const pi = static_cast<Real>(M_PI);
+				Real const c = static_cast<Real>(lightSpeed);
+				Real const mu0 = static_cast<Real>(magneticConstant);
+				Real const decibels = static_cast<Real>(8.68);
+				// TE11: lambda_c = pi * (D + d) / 2 * sqrt(epsilon)
+				Real const cutoffFactor = Real(2) * c / pi;
+
+				for (std::size_t i = 0; i < n; ++i) {
+					// 
+					Real const sqrtEpsilon = Math::sqrt(epsilon[i]);
+					Real const logRatio = Math::log(D[i] / d[i]);
+
+					Real const lambda = c / frequency[i] / sqrtEpsilon;
+					Real const omega = Real(2) * pi * frequency[i];
+					Real const R_superficial = Math::sqrt((omega * mu0) / (Real(2) * sigma[i]));
+
+					Real const alpha_d = tanDelta[i] * pi / lambda * decibels;
+					Real const alpha_m = sqrtEpsilon * (R_superficial / d[i] + R_superficial / D[i]) / (Real(120) * pi * logRatio) * decibels;
+					Real const u = Ep[i] * (D[i] / Real(2)) * logRatio;
+
+					wavelength[i] = lambda;
+					phaseSpeed[i] = c / sqrtEpsilon;
+					characteristicResistance[i] = Real(120) * pi / sqrtEpsilon;
+					dielectricAttenuation[i] = alpha_d;
+					metalAttenuation[i] = alpha_m;
+					totalAttenuation[i] = alpha_d + alpha_m;
+					waveResistance[i] = Real(60) * logRatio / sqrtEpsilon;
+					peakVoltage[i] = u;
+					peakPower[i] = (u * u / Real(120)) * Math::sqrt(epsilon[i] / logRatio);
+					if constexpr (Modes) {
+						Real const cutoff = cutoffFactor / ((D[i] + d[i]) * sqrtEpsilon);
+						cutoffFrequency[i] = cutoff;
+						singleMode[i] = static_cast<std::uint8_t>(frequency[i] < cutoff);
+					}
+				}
+			}
+		}
+
+		//            
+		//      (NaN  ),   
+		//in -   
+		//out -   (    )
+		//Math -    (sqrt, log),   -  
+		template<typename Math = exactMath, typename Real>
+		void computeUnchecked(basicInputs<Real> const& in, basicOutputs<Real> const& out) {
+			std::size_t const n = rows(in);
+			if (out.wavelength.size() != n || out.phaseSpeed.size() != n || out.characteristicResistance.size() != n ||
+				out.dielectricAttenuation.size() != n || out.metalAttenuation.size() != n || out.totalAttenuation.size() != n ||
+				out.waveResistance.size() != n || out.peakVoltage.size() != n || out.peakPower.size() != n)
+				throw exception(L"      ,    ");
+			//   :         
+			if (out.cutoffFrequency.empty() != out.singleMode.empty() || (!out.cutoffFrequency.empty() && (out.cutoffFrequency.size() != n || out.singleMode.size() != n)))
+				throw exception(L"          ,    ");
+
+			if (out.cutoffFrequency.empty())
+				detail::computeRows<Math, false>(n, in.d.data(), in.D.data(), in.frequency.data(), in.sigma.data(), in.epsilon.data(), in.Ep.data(), in.tanDelta.data(),
+					out.wavelength.data(), out.phaseSpeed.data(), out.characteristicResistance.data(), out.dielectricAttenuation.data(),
+					out.metalAttenuation.data(), out.totalAttenuation.data(), out.waveResistance.data(), out.peakVoltage.data(), out.peakPower.data(),
+					static_cast<Real*>(nullptr), static_cast<std::uint8_t*>(nullptr));
+			else
+				detail::computeRows<Math, true>(n, in.d.data(), in.D.data(), in.frequency.data(), in.sigma.data(), in.epsilon.data(), in.Ep.data(), in.tanDelta.data(),
+					out.wavelength.data(), out.phaseSpeed.data(), out.characteristicResistance.data(), out.dielectricAttenuation.data(),
+					out.metalAttenuation.data(), out.totalAttenuation.data(), out.waveResistance.data(), out.peakVoltage.data(), out.peakPower.data(),
+					out.cutoffFrequency.data(), out.singleMode.data());
+		}
+
+		//        
+		//in -   
+		//out -   (    )
+		//Math -    (sqrt, log),   -  
+		template<typename Math = exactMath, typename Real>
+		void compute(basicInputs<Real> const& in, basicOutputs<Real> const& out) {
+			validate(in);
+			computeUnchecked<Math>(in, out);
+		}
+
+		//     -  
+		//     ,  :     NaN,
+		//      ( -  message(firstError(mask))  )
+		//   
+		//in -   
+		//out -   (    )
+		//masks -     (   )
+		//Math -    (sqrt, log),   -  
+		template<typename Math = exactMath, typename Real>
+		std::size_t tryCompute(basicInputs<Real> const& in, basicOutputs<Real> const& out, span<errorMask> const masks) {
+			std::size_t const invalid = violations(in, masks);
+			computeUnchecked<Math>(in, out);
+			if (invalid == 0)
+				return 0;
+
+			Real const nan = std::numeric_limits<Real>::quiet_NaN();
+			span<Real> const columns[] = { out.wavelength, out.phaseSpeed, out.characteristicResistance, out.dielectricAttenuation,
+				out.metalAttenuation, out.totalAttenuation, out.waveResistance, out.peakVoltage, out.peakPower };
+			for (span<Real> const& column : columns) {
+				Real* __restrict values = column.data();
+				for (std::size_t i = 0; i < column.size(); ++i)
+					values[i] = masks[i] != 0 ? nan : values[i];
+			}
+			if (!out.cutoffFrequency.empty()) {
+				Real* __restrict cutoff = out.cutoffFrequency.data();
+				std::uint8_t* __restrict singleMode = out.singleMode.data();
+				for (std::size_t i = 0; i < out.cutoffFrequency.size(); ++i) {
+					cutoff[i] = masks[i] != 0 ? nan : cutoff[i];
+					singleMode[i] = masks[i] != 0 ? std::uint8_t(0) : singleMode[i];
+				}
+			}
+			return invalid;
+		}
+
+#ifdef _DEBUG
+		//  :    
+		class testCompute {
+			//  
+			//value -   
+			//expected -   
+			static void checkClose(double value, double expected) {
+				double const delta = abs(value - expected);
+				assert(delta <= 1e-12 * abs(expected));
+			}
+		public:
+			testCompute() {
+				test();
+			}
+
+			static void test() {
+				double const d[] = { 2.1e-3, 1.5e-3, 1.0 };
+				double const D[] = { 7.3e-3, 4.86e-3, 5.0 };
+				double const frequency[] = { 1e10, 8.5e9, 2e9 };
+				double const sigma[] = { 6.1e7, 6.1e7, 1e8 };
+				double const epsilon[] = { 2.08, 2.08, 1.0 };
+				double const Ep[] = { 2.5e7, 5e7, 3e7 };
+				double const tanDelta[] = { 2.5e-4, 2.5e-4, 1e-2 };
+				Inputs const in{ d, D, frequency, sigma, epsilon, Ep, tanDelta };
+
+				double wavelength[3], phaseSpeed[3], characteristicResistance[3], dielectricAttenuation[3], metalAttenuation[3],
+					totalAttenuation[3], waveResistance[3], peakVoltage[3], peakPower[3];
+				Outputs const out{ wavelength, phaseSpeed, characteristicResistance, dielectricAttenuation, metalAttenuation,
+					totalAttenuation, waveResistance, peakVoltage, peakPower, {}, {} };
+				compute(in, out);
+
+				for (std::size_t i = 0; i < 3; ++i) {
+					checkClose(wavelength[i], wavelengthInTheLine(frequency[i], epsilon[i]));
+					checkClose(phaseSpeed[i], Coaxial::phaseSpeed(epsilon[i]));
+					checkClose(characteristicResistance[i], Coaxial::characteristicResistance(epsilon[i]));
+					checkClose(dielectricAttenuation[i], attenuationCoefficientInDielectric(tanDelta[i], wavelength[i]));
+					checkClose(metalAttenuation[i], attenuationCoefficientInMetal(frequency[i], sigma[i], epsilon[i], d[i], D[i]));
+					checkClose(totalAttenuation[i], totalAttenuationCoefficient(tanDelta[i], frequency[i], sigma[i], epsilon[i], d[i], D[i]));
+					checkClose(waveResistance[i], Coaxial::waveResistance(epsilon[i], d[i], D[i]));
+					checkClose(peakVoltage[i], Coaxial::peakVoltage(Ep[i], d[i], D[i]));
+					checkClose(peakPower[i], Coaxial::peakPower(epsilon[i], Ep[i], d[i], D[i]));
+				}
+
+				//         :    
+				double cutoff[3];
+				std::uint8_t singleMode[3];
+				double const previous = totalAttenuation[0];
+				compute(in, Outputs{ wavelength, phaseSpeed, characteristicResistance, dielectricAttenuation, metalAttenuation,
+					totalAttenuation, waveResistance, peakVoltage, peakPower, cutoff, singleMode });
+				assert(totalAttenuation[0] == previous);
+				for (std::size_t i = 0; i < 3; ++i) {
+					checkClose(cutoff[i], cutoffFrequency(epsilon[i], d[i], D[i]));
+					assert(singleMode[i] == (frequency[i] < cutoff[i] ? 1 : 0));
+				}
+				//8.5    20.8 , 2    31.8   d = 1 , D = 5 
+				assert(singleMode[1] == 1 && singleMode[2] == 0);
+
+				//     
+				double const badD[] = { 2.1e-3, 1.0e-3, 5.0 };
+				bool thrown = false;
+				try {
+					compute(Inputs{ d, badD, frequency, sigma, epsilon, Ep, tanDelta }, out);
+				}
+				catch (exception const&) {
+					thrown = true;
+				}
+				assert(thrown);
+
+				// :      NaN,   
+				//(   ,       )
+				double const partialD[] = { 7.3e-3, 1.0e-3, 5.0 };
+				errorMask masks[3];
+				std::size_t const invalid = tryCompute(Inputs{ d, partialD, frequency, sigma, epsilon, Ep, tanDelta }, out, masks);
+				assert(invalid == 1);
+				assert(masks[0] == 0 && masks[2] == 0);
+				assert(masks[1] == errorBit(error::diameters));
+				assert(waveResistance[1] != waveResistance[1]);
+				checkClose(waveResistance[0], Coaxial::waveResistance(epsilon[0], d[0], D[0]));
+
+				// :     float
+				float const dSingle[] = { 2.1e-3f }, DSingle[] = { 7.3e-3f }, frequencySingle[] = { 1e10f }, sigmaSingle[] = { 6.1e7f },
+					epsilonSingle[] = { 2.08f }, EpSingle[] = { 2.5e7f }, tanDeltaSingle[] = { 2.5e-4f };
+				float single[9][1];
+				compute(basicInputs<float>{ dSingle, DSingle, frequencySingle, sigmaSingle, epsilonSingle, EpSingle, tanDeltaSingle },
+					basicOutputs<float>{ single[0], single[1], single[2], single[3], single[4], single[5], single[6], single[7], single[8], {}, {} });
+				assert(abs(single[5][0] - totalAttenuation[0]) <= 1e-5 * totalAttenuation[0]);
+				assert(abs(single[8][0] - peakPower[0]) <= 1e-5 * peakPower[0]);
+			}
+		} test_Compute;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
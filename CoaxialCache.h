@@ -0,0 +1,344 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialParallel.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//       ( ,    )
+// -       ( ==,  ),  -  tryEvaluate
+//(      ,        ).
+//        ;     ,      
+//      CLOCK (    ,   ,
+//  LRU;           ).
+//     ,         .
+// (, ,  ,  )  double   evaluate  exactMath,  
+//,      double  .  long double (x87)     .
+// (, , evaluate,         ) -  benchmarks.cpp ( CoaxialBenchmarks).
+
+namespace Coaxial {
+	namespace cache {
+		// 
+		struct statistics {
+			//
+			std::uint64_t hits;
+			// ()
+			std::uint64_t misses;
+			// 
+			std::uint64_t evictions;
+			//  
+			std::uint64_t size;
+
+			//  (0,    )
+			double hitRate() const noexcept {
+				std::uint64_t const total = hits + misses;
+				return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+			}
+		};
+
+		//  
+		//Math -    (sqrt, log)
+		//Real -      (float, double, long double)
+		template<typename Real, typename Math = exactMath>
+		class basicCache {
+			// :    (-0   +0),  ;
+			//   ,  -   .
+			// long double  64    ,   double:     ,
+			// std::hash<long double> ( frexp   )    
+			static std::uint64_t hashOf(basicDesign<Real> const& design) noexcept {
+				Real const fields[] = { design.d, design.D, design.frequency, design.sigma, design.epsilon, design.Ep, design.tanDelta };
+				std::uint64_t result = 0;
+				for (Real const field : fields) {
+					Real const positive = field + Real(0);
+					std::uint64_t bits;
+					if constexpr (sizeof(Real) == sizeof(std::uint64_t))
+						std::memcpy(&bits, &positive, sizeof bits);
+					else if constexpr (sizeof(Real) == sizeof(std::uint32_t)) {
+						std::uint32_t narrow;
+						std::memcpy(&narrow, &positive, sizeof narrow);
+						bits = narrow;
+					}
+					else {
+						double const rounded = static_cast<double>(positive);
+						std::memcpy(&bits, &rounded, sizeof bits);
+					}
+					result = (result ^ bits) * 0x9E3779B97F4A7C15ull;
+				}
+				return result ^ (result >> 32);
+			}
+			//  (  ;   NaN    )
+			static bool equal(basicDesign<Real> const& a, basicDesign<Real> const& b) noexcept {
+				return a.d == b.d && a.D == b.D && a.frequency == b.frequency && a.sigma == b.sigma &&
+					a.epsilon == b.epsilon && a.Ep == b.Ep && a.tanDelta == b.tanDelta;
+			}
+			// 
+			struct slot {
+				basicDesign<Real> design;
+				std::uint64_t hash;
+				expected<basicResults<Real>> result;
+				//  CLOCK
+				bool referenced;
+			};
+			// 
+			struct shard {
+				std::mutex mutex;
+				//   :   + 1 (0 -  );  -     2 * 
+				std::vector<std::uint32_t> table;
+				// (  ,  )
+				std::vector<slot> slots;
+				// CLOCK
+				std::size_t hand = 0;
+				std::uint64_t hits = 0, misses = 0, evictions = 0;
+
+				//          
+				//hash -  
+				//design - 
+				std::size_t find(std::uint64_t const hash, basicDesign<Real> const& design) const noexcept {
+					std::size_t const mask = table.size() - 1;
+					std::size_t cell = static_cast<std::size_t>(hash) & mask;
+					while (table[cell] != 0) {
+						slot const& entry = slots[table[cell] - 1];
+						if (entry.hash == hash && equal(entry.design, design))
+							break;
+						cell = (cell + 1) & mask;
+					}
+					return cell;
+				}
+				//        (   )
+				//cell -  
+				void erase(std::size_t cell) noexcept {
+					std::size_t const mask = table.size() - 1;
+					for (std::size_t next = (cell + 1) & mask; table[next] != 0; next = (next + 1) & mask) {
+						std::size_t const home = static_cast<std::size_t>(slots[table[next] - 1].hash) & mask;
+						// next    cell,        (cell, next]
+						if (((next - home) & mask) >= ((next - cell) & mask)) {
+							table[cell] = table[next];
+							cell = next;
+						}
+					}
+					table[cell] = 0;
+				}
+			};
+
+			//
+			std::vector<shard> shards_;
+			// 
+			std::size_t capacity_;
+			//    
+			unsigned shift_;
+
+			// 
+			//hash -  
+			shard& shardOf(std::uint64_t const hash) noexcept {
+				return shards_[shift_ >= 64 ? 0 : static_cast<std::size_t>(hash >> shift_)];
+			}
+		public:
+			//
+			//capacity -   (   )
+			//shards -   ( ; 0 -     * 4,  )
+			explicit basicCache(std::size_t const capacity = 4096, std::size_t shards = 0) {
+				if (shards == 0) {
+					shards = 1;
+					while (shards < 4 * static_cast<std::size_t>(std::max(1u, std::thread::hardware_concurrency())))
+						shards *= 2;
+				}
+				if ((shards & (shards - 1)) != 0)
+					throw exception(L"      ");
+				if (capacity < shards)
+					throw exception(L"       ");
+				capacity_ = capacity / shards;
+				unsigned bits = 0;
+				while ((std::size_t(1) << bits) < shards)
+					++bits;
+				shift_ = 64 - bits;
+				std::size_t cells = 1;
+				while (cells < 2 * capacity_)
+					cells *= 2;
+				shards_ = std::vector<shard>(shards);
+				for (shard& part : shards_) {
+					part.table.assign(cells, 0);
+					part.slots.reserve(capacity_);
+				}
+			}
+
+			basicCache(basicCache const&) = delete;
+			basicCache& operator=(basicCache const&) = delete;
+
+			//  :     tryEvaluate  
+			//design -  
+			expected<basicResults<Real>> tryEvaluate(basicDesign<Real> const& design) {
+				//  NaN          -   
+				if (!equal(design, design))
+					return Coaxial::tryEvaluate<Math>(design);
+				std::uint64_t const hash = hashOf(design);
+				shard& part = shardOf(hash);
+				{
+					std::lock_guard<std::mutex> const lock(part.mutex);
+					std::size_t const cell = part.find(hash, design);
+					if (part.table[cell] != 0) {
+						slot& entry = part.slots[part.table[cell] - 1];
+						entry.referenced = true;
+						++part.hits;
+						return entry.result;
+					}
+					++part.misses;
+				}
+
+				//   
+				expected<basicResults<Real>> const result = Coaxial::tryEvaluate<Math>(design);
+
+				std::lock_guard<std::mutex> const lock(part.mutex);
+				//       
+				if (part.table[part.find(hash, design)] != 0)
+					return result;
+				std::size_t victim = part.slots.size();
+				if (victim < capacity_)
+					part.slots.push_back({ design, hash, result, false });
+				else {
+					//CLOCK:       
+					while (part.slots[part.hand].referenced) {
+						part.slots[part.hand].referenced = false;
+						part.hand = (part.hand + 1) % capacity_;
+					}
+					victim = part.hand;
+					part.hand = (part.hand + 1) % capacity_;
+					slot& evicted = part.slots[victim];
+					part.erase(part.find(evicted.hash, evicted.design));
+					evicted = { design, hash, result, false };
+					++part.evictions;
+				}
+				//   :     
+				part.table[part.find(hash, design)] = static_cast<std::uint32_t>(victim + 1);
+				return result;
+			}
+
+			//    ;    -     ,  evaluate
+			//design -  
+			basicResults<Real> evaluate(basicDesign<Real> const& design) {
+				expected<basicResults<Real>> const result = tryEvaluate(design);
+				if (!result)
+					throw exception(result.code());
+				return result.value;
+			}
+
+			//   
+			statistics counters() {
+				statistics total{ 0, 0, 0, 0 };
+				for (shard& part : shards_) {
+					std::lock_guard<std::mutex> const lock(part.mutex);
+					total.hits += part.hits;
+					total.misses += part.misses;
+					total.evictions += part.evictions;
+					total.size += part.slots.size();
+				}
+				return total;
+			}
+
+			//     
+			void clear() {
+				for (shard& part : shards_) {
+					std::lock_guard<std::mutex> const lock(part.mutex);
+					std::fill(part.table.begin(), part.table.end(), 0u);
+					part.slots.clear();
+					part.hand = 0;
+					part.hits = part.misses = part.evictions = 0;
+				}
+			}
+		};
+
+		//  -  
+		using Cache = basicCache<double>;
+
+#ifdef _DEBUG
+		// : ,  CLOCK,  ,  
+		class testCache {
+			//  
+			//a, b - 
+			static bool same(Results const& a, Results const& b) noexcept {
+				return a.wavelength == b.wavelength && a.totalAttenuation == b.totalAttenuation && a.waveResistance == b.waveResistance &&
+					a.peakPower == b.peakPower;
+			}
+		public:
+			testCache() {
+				test();
+			}
+
+			static void test() {
+				Design const design{ 2.1e-3, 7.3e-3, 1e10, 6.1e7, 2.08, 2.5e7, 2.5e-4 };
+				Cache cache(4, 1);
+				assert(same(cache.evaluate(design), Coaxial::evaluate(design)));
+				assert(same(cache.evaluate(design), Coaxial::evaluate(design)));
+				statistics counted = cache.counters();
+				assert(counted.hits == 1 && counted.misses == 1 && counted.size == 1);
+				assert(counted.hitRate() == 0.5);
+
+				//     
+				Design bad = design;
+				bad.D = 1e-3;
+				for (int attempt = 0; attempt < 2; ++attempt) {
+					error thrown = error::none;
+					try {
+						cache.evaluate(bad);
+					}
+					catch (exception const& e) {
+						thrown = e.code();
+					}
+					assert(thrown == error::diameters);
+				}
+				assert(cache.counters().hits == 2);
+
+				// 4: design  bad  ,      
+				for (int k = 0; k < 3; ++k) {
+					Design other = design;
+					other.frequency = 1e9 * (k + 1);
+					cache.evaluate(other);
+				}
+				counted = cache.counters();
+				assert(counted.size == 4 && counted.evictions == 1);
+				cache.evaluate(design);
+				assert(cache.counters().hits == 3);
+
+				//    :        
+				Cache small(16, 1);
+				for (int i = 0; i < 2000; ++i) {
+					Design query = design;
+					query.frequency = 1e9 * ((i * 13) % 40 + 1);
+					assert(same(small.evaluate(query), Coaxial::evaluate(query)));
+				}
+				counted = small.counters();
+				assert(counted.size == 16 && counted.evictions == counted.misses - 16);
+
+				// :    evaluate,   -  
+				Cache shared(64, 8);
+				std::atomic<int> mismatches(0);
+				parallel::run(4, [&](unsigned const t) {
+					for (unsigned i = 0; i < 1000; ++i) {
+						Design query = design;
+						query.frequency = 1e9 * ((i * 7 + t) % 100 + 1);
+						if (!same(shared.evaluate(query), Coaxial::evaluate(query)))
+							++mismatches;
+					}
+				});
+				assert(mismatches == 0);
+				counted = shared.counters();
+				assert(counted.hits + counted.misses == 4000 && counted.size <= 64);
+
+				//long double: ,     double ( ),  
+				basicCache<long double> wide(4, 1);
+				basicDesign<long double> const near{ 2.1e-3L, 7.3e-3L, 1e10L, 6.1e7L, 2.08L, 2.5e7L, 2.5e-4L };
+				basicDesign<long double> nearer = near;
+				nearer.frequency = std::nextafter(near.frequency, 2e10L);
+				assert(wide.evaluate(near).wavelength == Coaxial::evaluate(near).wavelength);
+				assert(wide.evaluate(nearer).wavelength == Coaxial::evaluate(nearer).wavelength);
+				assert(wide.evaluate(near).wavelength == Coaxial::evaluate(near).wavelength);
+				counted = wide.counters();
+				assert(counted.hits == 1 && counted.misses == 2 && counted.size == 2);
+			}
+		} test_Cache;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
@@ -0,0 +1,462 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialParallel.h"
+#include "CoaxialSpan.h"
+#include "CoaxialSweep.h"
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+//        (   ABCD)
+//  l -      Z (waveResistance)   
+//gamma = alpha + j * beta,  beta = 2 * pi / wavelength, alpha -   totalAttenuation,   /  /
+//(alpha = totalAttenuation * ln(10) / 20,        totalAttenuation * l):
+//  | cosh(gamma * l)       Z * sinh(gamma * l) |
+//  | sinh(gamma * l) / Z   cosh(gamma * l)     |
+//       (sweepTerms)      .
+//  -      ;  ,   
+//    (blockSize),    ,    
+//  ( O(log n)).   (       ) -
+// :  ,     (up-sweep / down-sweep)    .
+//          ,        .
+//     (  ,   waveResistance).
+// ( x )    .     (10^4 , 1000 ,   
+//  ) -  benchmarks.cpp ( CoaxialBenchmarks).
+
+namespace Coaxial {
+	namespace cascade {
+		//  
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicSegment {
+			//   , 
+			Real d;
+			//  , 
+			Real D;
+			// , /
+			Real sigma;
+			//  
+			Real epsilon;
+			//    
+			Real tanDelta;
+			// , 
+			Real length;
+		};
+
+		//  (ABCD) :           
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicAbcd {
+			std::complex<Real> A;
+			//
+			std::complex<Real> B;
+			//
+			std::complex<Real> C;
+			std::complex<Real> D;
+
+			//  (  )
+			static basicAbcd identity() noexcept {
+				return { Real(1), Real(0), Real(0), Real(1) };
+			}
+		};
+
+		// :  left,  right
+		//left, right -  
+		template<typename Real>
+		basicAbcd<Real> operator*(basicAbcd<Real> const& left, basicAbcd<Real> const& right) noexcept {
+			return { left.A * right.A + left.B * right.C, left.A * right.B + left.B * right.D,
+				left.C * right.A + left.D * right.C, left.C * right.B + left.D * right.D };
+		}
+
+		//       
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicSParameters {
+			//  
+			std::complex<Real> s11;
+			//    
+			std::complex<Real> s21;
+			//    
+			std::complex<Real> s12;
+			//  
+			std::complex<Real> s22;
+		};
+
+		//    
+		//m -  
+		//impedance -  , 
+		template<typename Real>
+		basicSParameters<Real> sParameters(basicAbcd<Real> const& m, Real const impedance) noexcept {
+			std::complex<Real> const b = m.B / impedance;
+			std::complex<Real> const c = m.C * impedance;
+			std::complex<Real> const denominator = m.A + b + c + m.D;
+			return { (m.A + b - c - m.D) / denominator, Real(2) / denominator,
+				Real(2) * (m.A * m.D - m.B * m.C) / denominator, (-m.A + b - c + m.D) / denominator };
+		}
+
+		//     ,   -   ,    ,   ( )
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicLinkOutputs {
+			//  -20 * lg|s21|, 
+			span<Real> insertionLoss;
+			//  -20 * lg|s11|, 
+			span<Real> returnLoss;
+		};
+
+		//      (    )
+		constexpr std::size_t blockSize = 256;
+
+		// :     ,    
+		//Real -      (float, double, long double)
+		template<typename Real>
+		class basicRun {
+			//   c / sqrt(epsilon), /
+			std::vector<Real> wavelengthFactor_;
+			//   , /(*)
+			std::vector<Real> dielectricFactor_;
+			//     1 , /
+			std::vector<Real> metalFactor_;
+			// , 
+			std::vector<Real> waveResistance_;
+			//, 
+			std::vector<Real> length_;
+		public:
+			//
+			//segments -       
+			explicit basicRun(span<basicSegment<Real> const> const segments) {
+				if (segments.empty())
+					throw exception(L"       ");
+				std::size_t const n = segments.size();
+				wavelengthFactor_.resize(n);
+				dielectricFactor_.resize(n);
+				metalFactor_.resize(n);
+				waveResistance_.resize(n);
+				length_.resize(n);
+				for (std::size_t k = 0; k < n; ++k) {
+					basicSegment<Real> const& segment = segments[k];
+					//          
+					basicDesign<Real> const design{ segment.d, segment.D, Real(1), segment.sigma, segment.epsilon, Real(1), segment.tanDelta };
+					validateSweepDesign(design);
+					if (segment.length <= Real(0))
+						throw exception(error::length);
+					basicSweepTerms<Real> const terms = sweepTerms(design);
+					wavelengthFactor_[k] = terms.wavelengthFactor;
+					dielectricFactor_[k] = terms.dielectricFactor;
+					metalFactor_[k] = terms.metalFactor;
+					waveResistance_[k] = evaluateUnchecked(design).waveResistance;
+					length_[k] = segment.length;
+				}
+			}
+
+			// 
+			std::size_t size() const noexcept {
+				return length_.size();
+			}
+
+			//  
+			//k -  
+			//frequency - , 
+			//sqrtFrequency - sqrt(frequency) (   )
+			basicAbcd<Real> matrix(std::size_t const k, Real const frequency, Real const sqrtFrequency) const noexcept {
+				using std::expm1;
+				using std::sin;
+				using std::cos;
+				Real const nepers = static_cast<Real>(M_LN10 / 20.0);
+				Real const attenuation = dielectricFactor_[k] * frequency + metalFactor_[k] * sqrtFrequency;
+				Real const a = attenuation * nepers * length_[k];
+				Real const b = Real(2) * static_cast<Real>(M_PI) * frequency / wavelengthFactor_[k] * length_[k];
+				//sinh  cosh -    (expm1   sinh    )
+				Real const growth = expm1(a);
+				Real const sinhA = growth * (growth + Real(2)) / (Real(2) * (growth + Real(1)));
+				Real const coshA = sinhA + Real(1) / (growth + Real(1));
+				Real const sinB = sin(b), cosB = cos(b);
+				std::complex<Real> const coshGamma(coshA * cosB, sinhA * sinB);
+				std::complex<Real> const sinhGamma(sinhA * cosB, coshA * sinB);
+				Real const impedance = waveResistance_[k];
+				return { coshGamma, sinhGamma * impedance, sinhGamma / impedance, coshGamma };
+			}
+
+			//   [first, last)  
+			//first, last -   
+			//frequency - , 
+			basicAbcd<Real> product(std::size_t const first, std::size_t const last, Real const frequency) const noexcept {
+				using std::sqrt;
+				Real const sqrtFrequency = sqrt(frequency);
+				basicAbcd<Real> result = basicAbcd<Real>::identity();
+				for (std::size_t k = first; k < last; ++k)
+					result = result * matrix(k, frequency, sqrtFrequency);
+				return result;
+			}
+		};
+
+		//  -  
+		using Segment = basicSegment<double>;
+		using Abcd = basicAbcd<double>;
+		using SParameters = basicSParameters<double>;
+		using LinkOutputs = basicLinkOutputs<double>;
+		using Run = basicRun<double>;
+
+		namespace detail {
+			//     (  )
+			//matrices -  ()
+			//count -   ( 0)
+			template<typename Real>
+			basicAbcd<Real> reduce(basicAbcd<Real>* const matrices, std::size_t count) noexcept {
+				while (count > 1) {
+					std::size_t const half = count / 2;
+					for (std::size_t i = 0; i < half; ++i)
+						matrices[i] = matrices[2 * i] * matrices[2 * i + 1];
+					//        
+					if (count % 2 != 0)
+						matrices[half] = matrices[count - 1];
+					count = half + count % 2;
+				}
+				return matrices[0];
+			}
+
+			//     :      ,    
+			//run - 
+			//frequencies - , 
+			//threads -   (0 -    )
+			template<typename Real>
+			std::vector<basicAbcd<Real>> totals(basicRun<Real> const& run, span<Real const> const frequencies, unsigned const threads) {
+				std::size_t const n = run.size();
+				std::size_t const blocks = (n + blockSize - 1) / blockSize;
+				std::size_t const points = frequencies.size();
+				std::vector<basicAbcd<Real>> partial(points * blocks);
+				parallel::forEach(points * blocks, threads, [&](std::size_t const item) {
+					std::size_t const point = item / blocks, block = item % blocks;
+					partial[item] = run.product(block * blockSize, std::min(n, (block + 1) * blockSize), frequencies[point]);
+				});
+				std::vector<basicAbcd<Real>> result(points);
+				parallel::forEach(points, threads, [&](std::size_t const point) {
+					result[point] = reduce(partial.data() + point * blocks, blocks);
+				});
+				return result;
+			}
+		}
+
+		//  
+		//frequencies - , 
+		template<typename Real>
+		void validateFrequencies(span<Real const> const frequencies) {
+			//   : NaN   
+			bool valid = true;
+			for (Real const frequency : frequencies)
+				valid &= frequency > Real(0);
+			if (!valid)
+				throw exception(error::frequency);
+		}
+
+		//   
+		//run - 
+		//frequency - , 
+		//threads -   (0 -    )
+		template<typename Real>
+		basicAbcd<Real> total(basicRun<Real> const& run, Real const frequency, unsigned const threads = 0) {
+			if (!(frequency > Real(0)))
+				throw exception(error::frequency);
+			return detail::totals(run, span<Real const>(&frequency, 1), threads)[0];
+		}
+
+		// : out[k] -         k 
+		//run - 
+		//frequency - , 
+		//out - ,    
+		//threads -   (0 -    )
+		template<typename Real>
+		void prefix(basicRun<Real> const& run, Real const frequency, span<basicAbcd<Real>> const out, unsigned const threads = 0) {
+			using std::sqrt;
+			if (!(frequency > Real(0)))
+				throw exception(error::frequency);
+			std::size_t const n = run.size();
+			if (out.size() != n)
+				throw exception(L"        ");
+
+			Real const sqrtFrequency = sqrt(frequency);
+			std::size_t const blocks = (n + blockSize - 1) / blockSize;
+			//       
+			std::size_t width = 1;
+			while (width < blocks)
+				width *= 2;
+			std::vector<basicAbcd<Real>> sums(width, basicAbcd<Real>::identity());
+
+			//    
+			parallel::forEach(blocks, threads, [&](std::size_t const block) {
+				basicAbcd<Real> sum = basicAbcd<Real>::identity();
+				for (std::size_t k = block * blockSize, last = std::min(n, (block + 1) * blockSize); k < last; ++k) {
+					out[k] = run.matrix(k, frequency, sqrtFrequency);
+					sum = sum * out[k];
+				}
+				sums[block] = sum;
+			});
+
+			//    :        ,
+			//      ,  -  ,    
+			for (std::size_t stride = 1; stride < width; stride *= 2)
+				for (std::size_t i = 2 * stride - 1; i < width; i += 2 * stride)
+					sums[i] = sums[i - stride] * sums[i];
+			sums[width - 1] = basicAbcd<Real>::identity();
+			for (std::size_t stride = width / 2; stride >= 1; stride /= 2)
+				for (std::size_t i = 2 * stride - 1; i < width; i += 2 * stride) {
+					basicAbcd<Real> const left = sums[i - stride];
+					sums[i - stride] = sums[i];
+					sums[i] = sums[i] * left;
+				}
+
+			//     
+			parallel::forEach(blocks, threads, [&](std::size_t const block) {
+				basicAbcd<Real> running = sums[block];
+				for (std::size_t k = block * blockSize, last = std::min(n, (block + 1) * blockSize); k < last; ++k) {
+					running = running * out[k];
+					out[k] = running;
+				}
+			});
+		}
+
+		//   :         
+		//run - 
+		//frequencies - , 
+		//impedance -   (  ), 
+		//out -   (   )
+		//threads -   (0 -    )
+		template<typename Real>
+		void sweep(basicRun<Real> const& run, span<Real const> const frequencies, Real const impedance,
+			basicLinkOutputs<Real> const& out, unsigned const threads = 0) {
+			using std::abs;
+			using std::log10;
+			std::size_t const n = frequencies.size();
+			span<Real> const columns[] = { out.insertionLoss, out.returnLoss };
+			for (span<Real> const& column : columns)
+				if (!column.empty() && column.size() != n)
+					throw exception(L"         ,    ");
+			if (!(impedance > Real(0)))
+				throw exception(error::impedance);
+			validateFrequencies(frequencies);
+
+			std::vector<basicAbcd<Real>> const matrices = detail::totals(run, frequencies, threads);
+			for (std::size_t i = 0; i < n; ++i) {
+				basicSParameters<Real> const s = sParameters(matrices[i], impedance);
+				if (!out.insertionLoss.empty())
+					out.insertionLoss[i] = Real(-20) * log10(abs(s.s21));
+				if (!out.returnLoss.empty())
+					out.returnLoss[i] = Real(-20) * log10(abs(s.s11));
+			}
+		}
+
+		//      
+		//run - 
+		//frequencies - , 
+		//impedance -   (  ), 
+		//out - ,   ,    
+		//threads -   (0 -    )
+		template<typename Real>
+		void scattering(basicRun<Real> const& run, span<Real const> const frequencies, Real const impedance,
+			span<basicSParameters<Real>> const out, unsigned const threads = 0) {
+			std::size_t const n = frequencies.size();
+			if (out.size() != n)
+				throw exception(L"        ");
+			if (!(impedance > Real(0)))
+				throw exception(error::impedance);
+			validateFrequencies(frequencies);
+
+			std::vector<basicAbcd<Real>> const matrices = detail::totals(run, frequencies, threads);
+			for (std::size_t i = 0; i < n; ++i)
+				out[i] = sParameters(matrices[i], impedance);
+		}
+
+#ifdef _DEBUG
+		// :        ,    
+		class testCascade {
+			//    
+			//value - 
+			//expected -  
+			//precision -   
+			static void checkClose(std::complex<double> const value, std::complex<double> const expected, double const precision) {
+				assert(abs(value - expected) <= precision * abs(expected));
+			}
+			//  
+			//a, b - 
+			static bool same(Abcd const& a, Abcd const& b) noexcept {
+				return a.A == b.A && a.B == b.B && a.C == b.C && a.D == b.D;
+			}
+		public:
+			testCascade() {
+				test();
+			}
+
+			static void test() {
+				//  75    50 :      
+				Segment const single{ 0.5e-3, 3.2e-3, 5.8e7, 1.5, 2e-4, 1.3 };
+				Run const one(span<Segment const>(&single, 1));
+				double const frequency = 1.7e9;
+				Design const design{ single.d, single.D, frequency, single.sigma, single.epsilon, 1.0, single.tanDelta };
+				Results const result = evaluate(design);
+				std::complex<double> const gamma(result.totalAttenuation * M_LN10 / 20.0, 2.0 * M_PI / result.wavelength);
+				std::complex<double> const t = std::tanh(gamma * single.length);
+				double const z = result.waveResistance;
+				std::complex<double> const input = z * (50.0 + z * t) / (z + 50.0 * t);
+				SParameters const s = sParameters(total(one, frequency), 50.0);
+				checkClose(s.s11, (input - 50.0) / (input + 50.0), 1e-10);
+				checkClose(s.s22, s.s11, 1e-10);
+				checkClose(s.s12, s.s21, 1e-10);
+
+				//      D/d:   -   
+				std::vector<Segment> segments;
+				double expected = 0;
+				for (std::size_t k = 0; k < 3001; ++k) {
+					double const scale = 1.0 + 0.5 * static_cast<double>(k % 7);
+					Segment const segment{ 1e-3 * scale, 3.5e-3 * scale, 5.8e7, 2.08, 2.5e-4, 0.1 + 0.01 * static_cast<double>(k % 5) };
+					segments.push_back(segment);
+					expected += evaluate(Design{ segment.d, segment.D, frequency, segment.sigma, segment.epsilon, 1.0, segment.tanDelta }).totalAttenuation * segment.length;
+				}
+				Run const run(span<Segment const>(segments.data(), segments.size()));
+				double const matched = evaluate(Design{ segments[0].d, segments[0].D, frequency, 5.8e7, 2.08, 1.0, 2.5e-4 }).waveResistance;
+				double const frequencies[] = { frequency, 2.5e9 };
+				double insertionLoss[2], returnLoss[2];
+				sweep(run, span<double const>(frequencies), matched, LinkOutputs{ insertionLoss, returnLoss }, 3);
+				assert(abs(insertionLoss[0] - expected) <= 1e-9 * expected);
+				assert(returnLoss[0] > 150.0);
+				SParameters parameters[2];
+				scattering(run, span<double const>(frequencies), matched, span<SParameters>(parameters), 2);
+				assert(abs(-20.0 * log10(abs(parameters[1].s21)) - insertionLoss[1]) <= 1e-12 * insertionLoss[1]);
+
+				//     
+				Abcd const serial = total(run, frequency, 1);
+				assert(same(serial, total(run, frequency, 4)));
+				std::vector<Abcd> prefixes(run.size()), serialPrefixes(run.size());
+				prefix(run, frequency, span<Abcd>(prefixes.data(), prefixes.size()), 3);
+				prefix(run, frequency, span<Abcd>(serialPrefixes.data(), serialPrefixes.size()), 1);
+				for (std::size_t k = 0; k < run.size(); ++k)
+					assert(same(prefixes[k], serialPrefixes[k]));
+
+				//    
+				Abcd running = Abcd::identity();
+				for (std::size_t k = 0; k < run.size(); ++k) {
+					running = running * run.matrix(k, frequency, sqrt(frequency));
+					if (k % 997 != 0 && k + 1 != run.size())
+						continue;
+					checkClose(prefixes[k].A, running.A, 1e-9);
+					checkClose(prefixes[k].B, running.B, 1e-9);
+					checkClose(prefixes[k].C, running.C, 1e-9);
+				}
+				checkClose(serial.A, running.A, 1e-9);
+				checkClose(serial.B, running.B, 1e-9);
+
+				// 
+				Segment bad = single;
+				bad.length = 0;
+				error thrown = error::none;
+				try {
+					Run const invalid(span<Segment const>(&bad, 1));
+				}
+				catch (exception const& e) {
+					thrown = e.code();
+				}
+				assert(thrown == error::length);
+			}
+		} test_Cascade;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
@@ -0,0 +1,310 @@
+#pragma once
+#include "Coaxial.h"
+#include <limits>
+
+//  Coaxial.h,     (constexpr)
+// sqrt  log   constexpr,    :
+//sqrt -    , log -   [sqrt(1/2), sqrt(2))   2 * atanh((m - 1) / (m + 1)).
+//  libm: sqrt -   1 ULP, log -   1 ULP  80- long double (GCC/Clang  x86)
+//   3 ULP,  long double   double (MSVC).
+//   ,   (   );
+//        Coaxial.h.
+//    Coaxial::exception;        .
+
+namespace Coaxial {
+	namespace compileTime {
+		// 
+		//x - 
+		constexpr double abs(double const x) noexcept {
+			return x < 0.0 ? -x : x;
+		}
+
+		// 
+		//x -  ( NaN   - NaN,  0 - 0,  +inf - +inf)
+		constexpr double sqrt(double const x) noexcept {
+			//  -  :  +inf    
+			if (x != x || x < 0.0)
+				return std::numeric_limits<double>::quiet_NaN();
+			if (x == 0.0 || x == std::numeric_limits<double>::infinity())
+				return x;
+			//     2  
+			double guess = 1.0;
+			double scaled = x;
+			while (scaled > 4.0) {
+				scaled *= 0.25;
+				guess *= 2.0;
+			}
+			while (scaled < 0.25) {
+				scaled *= 4.0;
+				guess *= 0.5;
+			}
+			//       ; ,    
+			guess = 0.5 * (guess + x / guess);
+			for (int i = 0; i < 64; ++i) {
+				double const next = 0.5 * (guess + x / guess);
+				if (!(next < guess))
+					break;
+				guess = next;
+			}
+			return guess;
+		}
+
+		// 
+		//x -  ( NaN   - NaN,  0 - -inf,  +inf - +inf)
+		constexpr double log(double const x) noexcept {
+			constexpr long double ln2 = 0.693147180559945309417232121458176568L;
+			constexpr double sqrt2 = 1.41421356237309504880;
+			//  -  :  0  +inf    
+			if (x != x || x < 0.0)
+				return std::numeric_limits<double>::quiet_NaN();
+			if (x == 0.0)
+				return -std::numeric_limits<double>::infinity();
+			if (x == std::numeric_limits<double>::infinity())
+				return x;
+			//  x = m * 2^k, m  [sqrt(1/2), sqrt(2));   2  0.5 
+			long double m = x;
+			int k = 0;
+			while (m >= sqrt2) {
+				m *= 0.5L;
+				++k;
+			}
+			while (m < sqrt2 * 0.5) {
+				m *= 2.0L;
+				--k;
+			}
+			//log(m) = 2 * (s + s^3 / 3 + s^5 / 5 + ...), |s| <= 0.1716
+			long double const s = (m - 1.0L) / (m + 1.0L);
+			long double const s2 = s * s;
+			long double power = s;
+			long double sum = 0.0L;
+			for (int n = 1; n < 64; n += 2) {
+				long double const term = power / n;
+				if (sum + term == sum)
+					break;
+				sum += term;
+				power *= s2;
+			}
+			return static_cast<double>(k * ln2 + 2.0L * sum);
+		}
+
+		//      ( )
+		//frequency -   , 
+		//epsilon -   
+		constexpr double wavelengthInTheLine(double const frequency, double const epsilon) {
+			if (frequency <= 0.0)
+				throw exception(error::frequency);
+			if (epsilon < 1.0)
+				throw exception(error::epsilon);
+
+			return lightSpeed / frequency / sqrt(epsilon);
+		}
+
+		//       , /
+		//epsilon -   
+		constexpr double phaseSpeed(double const epsilon) {
+			if (epsilon < 1.0)
+				throw exception(error::epsilon);
+
+			return lightSpeed / sqrt(epsilon);
+		}
+
+		//  , 
+		//epsilon -   
+		constexpr double characteristicResistance(double const epsilon) {
+			if (epsilon < 1.0)
+				throw exception(error::epsilon);
+
+			return 120.0 * M_PI * sqrt(1.0 / epsilon);
+		}
+
+		//      , /
+		//tanDelta -     
+		//wavelength -  , 
+		constexpr double attenuationCoefficientInDielectric(double const tanDelta, double const wavelength) {
+			if (tanDelta <= 0.0)
+				throw exception(error::tanDelta);
+			if (wavelength <= 0.0)
+				throw exception(error::wavelength);
+
+			return tanDelta * M_PI / wavelength * 8.68;
+		}
+
+		//      , /
+		//frequency -   , 
+		//sigma -  , /
+		//epsilon -   
+		//d -    , 
+		//D -   , 
+		constexpr double attenuationCoefficientInMetal(double const frequency, double const sigma, double const epsilon, double const d, double const D) {
+			if (frequency <= 0.0)
+				throw exception(error::frequency);
+			if (sigma <= 0.0)
+				throw exception(error::sigma);
+			if (epsilon < 1.0)
+				throw exception(error::epsilon);
+			if (D <= d)
+				throw exception(error::diameters);
+			if (d <= 0)
+				throw exception(error::innerDiameter);
+
+			double const omega = 2.0 * M_PI * frequency;
+			double const R_superficial = sqrt((omega * magneticConstant) / (2.0 * sigma));
+			double const alpha_m = sqrt(epsilon) * (R_superficial / d + R_superficial / D) / (120.0 * M_PI * log(D / d));
+			return alpha_m * 8.68;
+		}
+
+		//   , /
+		//tanDelta -     
+		//frequency -   , 
+		//sigma -  , /
+		//epsilon -   
+		//d -    , 
+		//D -   , 
+		constexpr double totalAttenuationCoefficient(double const tanDelta, double const frequency, double const sigma, double const epsilon, double const d, double const D) {
+			return attenuationCoefficientInDielectric(tanDelta, wavelengthInTheLine(frequency, epsilon)) +
+				attenuationCoefficientInMetal(frequency, sigma, epsilon, d, D);
+		}
+
+		// , 
+		//epsilon -   
+		//d -    , 
+		//D -   , 
+		constexpr double waveResistance(double const epsilon, double const d, double const D) {
+			if (epsilon < 1.0)
+				throw exception(error::epsilon);
+			if (D <= d)
+				throw exception(error::diameters);
+			if (d <= 0)
+				throw exception(error::innerDiameter);
+
+			return 60.0 * sqrt(1.0 / epsilon) * log(D / d);
+		}
+
+		// , 
+		//Ep -  , /
+		//d -    , 
+		//D -   , 
+		constexpr double peakVoltage(double const Ep, double const d, double const D) {
+			if (Ep <= 0)
+				throw exception(error::electricStrength);
+			if (D <= d)
+				throw exception(error::diameters);
+			if (d <= 0)
+				throw exception(error::innerDiameter);
+
+			return Ep * (D / 2.0) * log(D / d);
+		}
+
+		// , 
+		//epsilon -   
+		//Ep -  , /
+		//d -    , 
+		//D -   , 
+		constexpr double peakPower(double const epsilon, double const Ep, double const d, double const D) {
+			if (epsilon < 1.0)
+				throw exception(error::epsilon);
+
+			double const u = peakVoltage(Ep, d, D);
+			return (u * u / 120.0) * sqrt(epsilon / log(D / d));
+		}
+
+		//  
+		struct cable {
+			//
+			wchar_t const* name;
+			//  , 
+			double d;
+			//   (  ), 
+			double D;
+			//  
+			double epsilon;
+			//    
+			double tanDelta;
+			// , 
+			double waveResistance;
+			// , /
+			double phaseSpeed;
+			//    catalogFrequency   , /
+			double attenuation;
+		};
+
+		//,      , 
+		constexpr double catalogFrequency = 1e9;
+		// , /
+		constexpr double copperConductivity = 5.8e7;
+
+		// ,    
+		//name - 
+		//d -   , 
+		//D -   , 
+		//epsilon -   
+		//tanDelta -     
+		constexpr cable makeCable(wchar_t const* name, double const d, double const D, double const epsilon, double const tanDelta) {
+			return cable{ name, d, D, epsilon, tanDelta,
+				waveResistance(epsilon, d, D),
+				phaseSpeed(epsilon),
+				totalAttenuationCoefficient(tanDelta, catalogFrequency, copperConductivity, epsilon, d, D) };
+		}
+
+		//   ( ,    , )
+		constexpr cable standardCables[] = {
+			makeCable(L"RG-58", 0.81e-3, 2.95e-3, 2.25, 2e-4),
+			makeCable(L"RG-59", 0.58e-3, 3.7e-3, 2.25, 2e-4),
+			makeCable(L"RG-6", 1.02e-3, 4.57e-3, 1.5, 1e-4),
+			makeCable(L"RG-8", 2.17e-3, 7.24e-3, 2.25, 2e-4),
+			makeCable(L"RG-174", 0.48e-3, 1.52e-3, 2.25, 2e-4),
+			makeCable(L"RG-213", 2.26e-3, 7.24e-3, 2.25, 2e-4),
+			makeCable(L"RG-402", 0.92e-3, 2.98e-3, 2.08, 2.5e-4),
+			makeCable(L"2.1/7.3 ", 2.1e-3, 7.3e-3, 2.08, 2.5e-4),
+		};
+
+		//   :    
+		static_assert(abs(standardCables[7].waveResistance - 51.834) < 1e-3, "  ");
+		static_assert(abs(waveResistance(2.08, 1.5e-3, 4.86e-3) - 48.907) < 1e-3, " ");
+		static_assert(abs(totalAttenuationCoefficient(2.5e-4, 1e10, 6.1e7, 2.08, 2.1e-3, 7.3e-3) - 0.744) < 1e-3, " ");
+
+#ifdef _DEBUG
+		//  constexpr-:    Coaxial.h
+		class testCompileTime {
+			//  
+			//value -  constexpr-
+			//expected -   Coaxial.h
+			static void checkClose(double value, double expected) {
+				double const delta = abs(value - expected);
+				assert(delta <= 1e-14 * abs(expected));
+			}
+		public:
+			testCompileTime() {
+				test();
+			}
+
+			static void test() {
+				for (double x = 1e-6; x < 1e6; x *= 1.37) {
+					checkClose(compileTime::sqrt(x), std::sqrt(x));
+					checkClose(compileTime::log(x), std::log(x));
+				}
+				//  (      )
+				constexpr double infinity = std::numeric_limits<double>::infinity();
+				static_assert(compileTime::sqrt(infinity) == infinity && compileTime::log(0.0) == -infinity, "special values");
+				assert(compileTime::sqrt(0.0) == 0.0 && compileTime::sqrt(infinity) == infinity);
+				assert(compileTime::log(0.0) == -infinity && compileTime::log(infinity) == infinity);
+				double const nan = std::numeric_limits<double>::quiet_NaN();
+				for (double const x : { -1.0, -infinity, nan }) {
+					double const root = compileTime::sqrt(x), logarithm = compileTime::log(x);
+					assert(root != root && logarithm != logarithm);
+				}
+				// :  
+				checkClose(compileTime::log(std::numeric_limits<double>::denorm_min()), std::log(std::numeric_limits<double>::denorm_min()));
+
+				for (cable const& entry : standardCables) {
+					checkClose(entry.waveResistance, Coaxial::waveResistance(entry.epsilon, entry.d, entry.D));
+					checkClose(entry.phaseSpeed, Coaxial::phaseSpeed(entry.epsilon));
+					checkClose(entry.attenuation, Coaxial::totalAttenuationCoefficient(entry.tanDelta, catalogFrequency, copperConductivity, entry.epsilon, entry.d, entry.D));
+				}
+				checkClose(compileTime::peakPower(2.08, 2.5e7, 2.1e-3, 7.3e-3), Coaxial::peakPower(2.08, 2.5e7, 2.1e-3, 7.3e-3));
+				checkClose(compileTime::characteristicResistance(2.08), Coaxial::characteristicResistance(2.08));
+			}
+		} test_CompileTime;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
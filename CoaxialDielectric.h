@@ -0,0 +1,493 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialSpan.h"
+#include "CoaxialSweep.h"
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+//- ()      
+// Coaxial.h epsilon  tanDelta ;    epsilon(f) = epsilon'(f) - j * epsilon''(f)
+//     -  (  , tanDelta     f1..f2).
+//        :
+//  n(f) = sqrt(epsilon')               -   c / (f * n),    ;
+//  q(f) = epsilon'' / sqrt(epsilon')   -    pi * 8.68 / c * f * q (= tanDelta * pi / wavelength * 8.68).
+//            log(f) (pointsPerDecade   )
+//    ;      ,      ,
+//     .    :  n  q ,   
+// -    ,  sweepFrequencyUnchecked.
+//  (64   , , epsilon'  epsilon''):   - 2.1e-8,  -  - 2.2e-10
+//(32  - 3.3e-7  3.5e-9, 128  - 1.3e-9  1.4e-11).
+//   (logarithmicFrequencies) sweepLogarithmic      ,  
+//  ;    (sweepFrequency)  Math::log  .
+//      -  benchmarks.cpp ( CoaxialBenchmarks).
+
+namespace Coaxial {
+	namespace dielectric {
+		//     : epsilon(f) = epsilonInfinity + deltaEpsilon / (1 + j * f / relaxationFrequency)
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicDebye {
+			//      
+			Real epsilonInfinity;
+			//    
+			Real deltaEpsilon;
+			// , 
+			Real relaxationFrequency;
+
+			//  epsilon' - j * epsilon''
+			//frequency - , 
+			std::complex<Real> operator()(Real const frequency) const noexcept {
+				Real const x = frequency / relaxationFrequency;
+				Real const denominator = Real(1) + x * x;
+				return { epsilonInfinity + deltaEpsilon / denominator, -deltaEpsilon * x / denominator };
+			}
+		};
+
+		//  - : epsilon(f) = epsilonInfinity + deltaEpsilon / ln(f2 / f1) * ln((f2 + j * f) / (f1 + j * f))
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicDjordjevicSarkar {
+			//     f2
+			Real epsilonInfinity;
+			//   f1   f2
+			Real deltaEpsilon;
+			//    f1, 
+			Real lowerFrequency;
+			//    f2, 
+			Real upperFrequency;
+
+			//          (    )
+			//epsilon -  epsilon'   referenceFrequency
+			//tanDelta -      referenceFrequency
+			//referenceFrequency -  , 
+			//lowerFrequency, upperFrequency -   ,  ( 1   1 )
+			static basicDjordjevicSarkar fit(Real const epsilon, Real const tanDelta, Real const referenceFrequency,
+				Real const lowerFrequency = Real(1e3), Real const upperFrequency = Real(1e12)) {
+				if (epsilon < Real(1))
+					throw exception(error::epsilon);
+				if (tanDelta <= Real(0))
+					throw exception(error::tanDelta);
+				if (referenceFrequency <= Real(0) || lowerFrequency <= Real(0) || upperFrequency <= lowerFrequency)
+					throw exception(error::frequency);
+
+				basicDjordjevicSarkar model{ Real(0), Real(1), lowerFrequency, upperFrequency };
+				std::complex<Real> const shape = model(referenceFrequency);
+				//shape = deltaEpsilon * F  epsilonInfinity = 0, deltaEpsilon = 1; -Im F > 0
+				model.deltaEpsilon = epsilon * tanDelta / -shape.imag();
+				model.epsilonInfinity = epsilon - model.deltaEpsilon * shape.real();
+				return model;
+			}
+
+			//  epsilon' - j * epsilon''
+			//frequency - , 
+			std::complex<Real> operator()(Real const frequency) const noexcept {
+				using std::log;
+				std::complex<Real> const ratio = std::complex<Real>(upperFrequency, frequency) / std::complex<Real>(lowerFrequency, frequency);
+				return std::complex<Real>(epsilonInfinity) + deltaEpsilon / log(upperFrequency / lowerFrequency) * std::log(ratio);
+			}
+		};
+
+		// : n(f) = sqrt(epsilon')  q(f) = epsilon'' / sqrt(epsilon')     log(f)
+		//  -       t:     log(f)      .
+		//   (  n,   q)        (64   double).
+		//Real -      (float, double, long double)
+		template<typename Real>
+		class basicTable {
+			//  
+			static constexpr std::size_t stride = 8;
+
+			//  
+			Real logFirst_;
+			//      
+			Real scale_;
+			// , 
+			Real first_, last_;
+			// : n = c0 + t * (c1 + t * (c2 + t * c3)), q -    c4..c7
+			std::vector<Real> coefficients_;
+
+			//n(f)  q(f)  n      
+			//n -  
+			//position -   i   (   ), Real(std::size_t i);     
+			//refraction -  n(f)
+			//loss -  q(f)
+			template<typename Position>
+			void interpolate(std::size_t const n, Position const& position, Real* __restrict refraction, Real* __restrict loss) const noexcept {
+				Real const* __restrict c = coefficients_.data();
+				Real const limit = static_cast<Real>(coefficients_.size() / stride - 1);
+				//:      
+				constexpr std::size_t block = 256;
+				std::int32_t indices[block];
+				for (std::size_t begin = 0; begin < n; begin += block) {
+					std::size_t const count = std::min(block, n - begin);
+					Real* __restrict x = refraction + begin;
+					Real* __restrict q = loss + begin;
+					//  -       (    ),     refraction
+					for (std::size_t i = 0; i < count; ++i) {
+						// :        
+						Real const t = position(begin + i);
+						Real const lower = t > Real(0) ? t : Real(0);
+						Real const clamped = lower < limit ? lower : limit;
+						std::int32_t const k = static_cast<std::int32_t>(clamped);
+						indices[i] = k * static_cast<std::int32_t>(stride);
+						x[i] = clamped - static_cast<Real>(k);
+					}
+					//  -    (gather)   
+					for (std::size_t i = 0; i < count; ++i) {
+						Real const* __restrict segment = c + indices[i];
+						Real const t = x[i];
+						x[i] = segment[0] + t * (segment[1] + t * (segment[2] + t * segment[3]));
+						q[i] = segment[4] + t * (segment[5] + t * (segment[6] + t * segment[7]));
+					}
+				}
+			}
+		public:
+			//
+			//model - : std::complex<Real>(Real frequency),  epsilon' - j * epsilon''
+			//first, last -  , 
+			//pointsPerDecade -    
+			template<typename Model>
+			basicTable(Model const& model, Real const first, Real const last, std::size_t const pointsPerDecade = 64) :first_(first), last_(last) {
+				using std::log;
+				using std::exp;
+				using std::sqrt;
+				using std::ceil;
+				if (first <= Real(0) || last <= first)
+					throw exception(error::frequency);
+				if (pointsPerDecade == 0)
+					throw exception(L"        0");
+
+				logFirst_ = log(first);
+				Real const range = log(last) - logFirst_;
+				std::size_t const segments = std::max<std::size_t>(1, static_cast<std::size_t>(ceil(range / log(Real(10)) * static_cast<Real>(pointsPerDecade))));
+				scale_ = static_cast<Real>(segments) / range;
+
+				//n  q      x
+				auto const sample = [&model](Real const x, Real& refraction, Real& loss) {
+					std::complex<Real> const epsilon = model(exp(x));
+					if (epsilon.real() < Real(1))
+						throw exception(error::epsilon);
+					if (-epsilon.imag() <= Real(0))
+						throw exception(error::tanDelta);
+					refraction = sqrt(epsilon.real());
+					loss = -epsilon.imag() / refraction;
+				};
+				//    t   ( -     1e-4  log(f))
+				Real const delta = Real(1e-4);
+				std::vector<Real> refraction(segments + 1), loss(segments + 1), refractionSlope(segments + 1), lossSlope(segments + 1);
+				for (std::size_t i = 0; i <= segments; ++i) {
+					Real const x = logFirst_ + static_cast<Real>(i) / scale_;
+					Real refractionLeft, lossLeft, refractionRight, lossRight;
+					sample(x, refraction[i], loss[i]);
+					sample(x - delta, refractionLeft, lossLeft);
+					sample(x + delta, refractionRight, lossRight);
+					refractionSlope[i] = (refractionRight - refractionLeft) / (Real(2) * delta * scale_);
+					lossSlope[i] = (lossRight - lossLeft) / (Real(2) * delta * scale_);
+				}
+
+				// segments -  last ( t = segments    0)
+				coefficients_.assign((segments + 1) * stride, Real(0));
+				for (std::size_t i = 0; i <= segments; ++i) {
+					Real* const c = coefficients_.data() + i * stride;
+					c[0] = refraction[i];
+					c[4] = loss[i];
+					if (i == segments)
+						break;
+					Real const* const values[] = { refraction.data(), loss.data() };
+					Real const* const slopes[] = { refractionSlope.data(), lossSlope.data() };
+					for (std::size_t column = 0; column < 2; ++column) {
+						Real const p0 = values[column][i], p1 = values[column][i + 1];
+						Real const m0 = slopes[column][i], m1 = slopes[column][i + 1];
+						c[column * 4 + 1] = m0;
+						c[column * 4 + 2] = Real(3) * (p1 - p0) - Real(2) * m0 - m1;
+						c[column * 4 + 3] = Real(2) * (p0 - p1) + m0 + m1;
+					}
+				}
+			}
+
+			//  , 
+			Real first() const noexcept {
+				return first_;
+			}
+			//  , 
+			Real last() const noexcept {
+				return last_;
+			}
+
+			//n(f)  q(f)      
+			//Math -    (log)
+			//n -  
+			//frequencies - , 
+			//refraction -  n(f)
+			//loss -  q(f)
+			template<typename Math = exactMath>
+			void lookup(std::size_t const n, Real const* __restrict frequencies, Real* __restrict refraction, Real* __restrict loss) const noexcept {
+				Real const logFirst = logFirst_;
+				Real const scale = scale_;
+				interpolate(n, [frequencies, logFirst, scale](std::size_t const i) noexcept {
+					return (Math::log(frequencies[i]) - logFirst) * scale;
+				}, refraction, loss);
+			}
+
+			//n(f)  q(f)  ,      (logarithmicFrequencies)
+			//    i - log(first) + i * step,     -   ,
+			//      
+			//begin -      
+			//n -   
+			//first -   , 
+			//step -      
+			//refraction -  n(f)
+			//loss -  q(f)
+			void lookupLogarithmic(std::size_t const begin, std::size_t const n, Real const first, Real const step,
+				Real* __restrict refraction, Real* __restrict loss) const noexcept {
+				using std::log;
+				Real const origin = (log(first) - logFirst_) * scale_;
+				Real const slope = step * scale_;
+				interpolate(n, [begin, origin, slope](std::size_t const i) noexcept {
+					return origin + slope * static_cast<Real>(begin + i);
+				}, refraction, loss);
+			}
+
+			//   
+			//frequency - ,  (  )
+			std::complex<Real> permittivity(Real const frequency) const noexcept {
+				Real refraction, loss;
+				lookup(1, &frequency, &refraction, &loss);
+				return { refraction * refraction, -loss * refraction };
+			}
+		};
+
+		//  -  
+		using Debye = basicDebye<double>;
+		using DjordjevicSarkar = basicDjordjevicSarkar<double>;
+		using Table = basicTable<double>;
+
+		namespace detail {
+			// : n  q   ,      
+			//Math -    (sqrt, log)
+			//design -   ( frequency, epsilon  tanDelta  )
+			//frequencies -  , 
+			//out -   (   )
+			//lookup - n  q : void(std::size_t begin, std::size_t count, Real* refraction, Real* loss)
+			template<typename Math, typename Real, typename Lookup>
+			void sweepBlocks(basicDesign<Real> const& design, span<Real const> const frequencies, basicSweepOutputs<Real> const& out,
+				Lookup const& lookup) {
+				std::size_t const n = frequencies.size();
+				span<Real> const columns[] = { out.wavelength, out.dielectricAttenuation, out.metalAttenuation, out.totalAttenuation };
+				for (span<Real> const& column : columns)
+					if (!column.empty() && column.size() != n)
+						throw exception(L"         ,    ");
+
+				//  epsilon = 1:      n(f)  q(f)
+				basicDesign<Real> vacuum = design;
+				vacuum.epsilon = Real(1);
+				vacuum.tanDelta = Real(1);
+				basicSweepTerms<Real> const terms = sweepTerms<Math>(vacuum);
+				Real const c = terms.wavelengthFactor;
+				Real const dielectricFactor = terms.dielectricFactor;
+				Real const metalFactor = terms.metalFactor;
+
+				// : n  q     L1
+				constexpr std::size_t block = 256;
+				Real refractionBlock[block], lossBlock[block];
+				for (std::size_t begin = 0; begin < n; begin += block) {
+					std::size_t const count = std::min(block, n - begin);
+					Real const* __restrict f = frequencies.data() + begin;
+					lookup(begin, count, refractionBlock, lossBlock);
+					Real const* __restrict refraction = refractionBlock;
+					Real const* __restrict loss = lossBlock;
+					if (!out.wavelength.empty()) {
+						Real* __restrict wavelength = out.wavelength.data() + begin;
+						for (std::size_t i = 0; i < count; ++i)
+							wavelength[i] = c / (f[i] * refraction[i]);
+					}
+					if (!out.dielectricAttenuation.empty()) {
+						Real* __restrict dielectricAttenuation = out.dielectricAttenuation.data() + begin;
+						for (std::size_t i = 0; i < count; ++i)
+							dielectricAttenuation[i] = dielectricFactor * f[i] * loss[i];
+					}
+					if (!out.metalAttenuation.empty()) {
+						Real* __restrict metalAttenuation = out.metalAttenuation.data() + begin;
+						for (std::size_t i = 0; i < count; ++i)
+							metalAttenuation[i] = metalFactor * refraction[i] * Math::sqrt(f[i]);
+					}
+					if (!out.totalAttenuation.empty()) {
+						Real* __restrict totalAttenuation = out.totalAttenuation.data() + begin;
+						for (std::size_t i = 0; i < count; ++i)
+							totalAttenuation[i] = dielectricFactor * f[i] * loss[i] + metalFactor * refraction[i] * Math::sqrt(f[i]);
+					}
+				}
+			}
+		}
+
+		//         
+		//         ,  -   
+		//Math -    (sqrt, log)
+		//design -   ( frequency, epsilon  tanDelta  )
+		//material -  
+		//frequencies -  , 
+		//out -   (   )
+		template<typename Math = exactMath, typename Real>
+		void sweepFrequencyUnchecked(basicDesign<Real> const& design, basicTable<Real> const& material, span<Real const> const frequencies,
+			basicSweepOutputs<Real> const& out) {
+			detail::sweepBlocks<Math>(design, frequencies, out,
+				[&material, frequencies](std::size_t const begin, std::size_t const count, Real* const refraction, Real* const loss) noexcept {
+					material.template lookup<Math>(count, frequencies.data() + begin, refraction, loss);
+				});
+		}
+
+		//     ,     ,    
+		//        (. basicTable::lookupLogarithmic),      
+		//Math -    (sqrt, log)
+		//design -   ( frequency, epsilon  tanDelta  )
+		//material -  
+		//first -  , 
+		//last -  , 
+		//frequencies -  ,  logarithmicFrequencies(first, last, frequencies)
+		//out -   (   )
+		template<typename Math = exactMath, typename Real>
+		void sweepLogarithmicUnchecked(basicDesign<Real> const& design, basicTable<Real> const& material, Real const first, Real const last,
+			span<Real const> const frequencies, basicSweepOutputs<Real> const& out) {
+			using std::log;
+			std::size_t const n = frequencies.size();
+			// -   logarithmicFrequencies
+			Real const step = n > 1 ? log(last / first) / static_cast<Real>(n - 1) : Real(0);
+			detail::sweepBlocks<Math>(design, frequencies, out,
+				[&material, first, step](std::size_t const begin, std::size_t const count, Real* const refraction, Real* const loss) noexcept {
+					material.lookupLogarithmic(begin, count, first, step, refraction, loss);
+				});
+		}
+
+		//     :        
+		//     ,  -     (      )
+		//Math -    (sqrt, log)
+		//design -   ( frequency, epsilon  tanDelta  )
+		//material -  
+		//frequencies -  , 
+		//out -   (   )
+		template<typename Math = exactMath, typename Real>
+		void sweepFrequency(basicDesign<Real> const& design, basicTable<Real> const& material, span<Real const> const frequencies,
+			basicSweepOutputs<Real> const& out) {
+			basicDesign<Real> geometry = design;
+			geometry.epsilon = Real(1);
+			geometry.tanDelta = Real(1);
+			validateSweepDesign(geometry);
+			Real const first = material.first();
+			Real const last = material.last();
+			errorMask invalid = 0;
+			for (Real const frequency : frequencies)
+				invalid |= errorMask(!(frequency >= first) || !(frequency <= last));
+			if (invalid != 0)
+				throw exception(error::frequency);
+			sweepFrequencyUnchecked<Math>(design, material, frequencies, out);
+		}
+
+		//     ,     
+		// sweepFrequency    :        ,     
+		//Math -    (sqrt, log)
+		//design -   ( frequency, epsilon  tanDelta  )
+		//material -  
+		//first -  ,  (  )
+		//last -  ,  (  )
+		//frequencies -  ,  logarithmicFrequencies(first, last, frequencies)
+		//out -   (   )
+		template<typename Math = exactMath, typename Real>
+		void sweepLogarithmic(basicDesign<Real> const& design, basicTable<Real> const& material, Real const first, Real const last,
+			span<Real const> const frequencies, basicSweepOutputs<Real> const& out) {
+			basicDesign<Real> geometry = design;
+			geometry.epsilon = Real(1);
+			geometry.tanDelta = Real(1);
+			validateSweepDesign(geometry);
+			if (!(first >= material.first()) || !(last <= material.last()) || !(first <= last))
+				throw exception(error::frequency);
+			//  logarithmicFrequencies ,     
+			std::size_t const n = frequencies.size();
+			if (n != 0 && (frequencies[0] != first || (n > 1 && frequencies[n - 1] != last)))
+				throw exception(L"     logarithmicFrequencies       ");
+			sweepLogarithmicUnchecked<Math>(design, material, first, last, frequencies, out);
+		}
+
+#ifdef _DEBUG
+		//  :    - ,  ,   evaluate   
+		class testDielectric {
+		public:
+			testDielectric() {
+				test();
+			}
+
+			static void test() {
+				//:      epsilon  tanDelta, tanDelta    
+				DjordjevicSarkar const ptfe = DjordjevicSarkar::fit(2.08, 2.5e-4, 1e10);
+				std::complex<double> const measured = ptfe(1e10);
+				assert(abs(measured.real() - 2.08) < 1e-12 && abs(-measured.imag() / measured.real() - 2.5e-4) < 1e-15);
+				std::complex<double> const low = ptfe(1e7);
+				assert(low.real() > measured.real() && abs(-low.imag() / low.real() - 2.5e-4) < 0.1 * 2.5e-4);
+
+				//   
+				Debye const debye{ 3.0, 1.5, 2e9 };
+				Table const debyeTable(debye, 1e6, 1e11);
+				Table const ptfeTable(ptfe, 1e6, 1e11);
+				double frequencies[997];
+				logarithmicFrequencies(1e6, 1e11, span<double>(frequencies));
+				for (double const frequency : frequencies) {
+					std::complex<double> const exactDebye = debye(frequency), tabulatedDebye = debyeTable.permittivity(frequency);
+					assert(abs(tabulatedDebye.real() - exactDebye.real()) <= 1e-7 * exactDebye.real());
+					assert(abs(tabulatedDebye.imag() - exactDebye.imag()) <= 1e-7 * abs(exactDebye.imag()));
+					std::complex<double> const exactPtfe = ptfe(frequency), tabulatedPtfe = ptfeTable.permittivity(frequency);
+					assert(abs(tabulatedPtfe.real() - exactPtfe.real()) <= 1e-9 * exactPtfe.real());
+					assert(abs(tabulatedPtfe.imag() - exactPtfe.imag()) <= 1e-9 * abs(exactPtfe.imag()));
+				}
+
+				//  evaluate        
+				double wavelength[997], dielectricAttenuation[997], metalAttenuation[997], totalAttenuation[997];
+				Design design{ 2.1e-3, 7.3e-3, 0.0, 6.1e7, 0.0, 2.5e7, 0.0 };
+				sweepFrequency(design, debyeTable, span<double const>(frequencies),
+					SweepOutputs{ wavelength, dielectricAttenuation, metalAttenuation, totalAttenuation });
+				for (std::size_t i = 0; i < 997; i += 7) {
+					std::complex<double> const epsilon = debye(frequencies[i]);
+					design.frequency = frequencies[i];
+					design.epsilon = epsilon.real();
+					design.tanDelta = -epsilon.imag() / epsilon.real();
+					Results const exact = Coaxial::evaluate(design);
+					assert(abs(wavelength[i] - exact.wavelength) <= 1e-7 * exact.wavelength);
+					assert(abs(dielectricAttenuation[i] - exact.dielectricAttenuation) <= 1e-7 * exact.dielectricAttenuation);
+					assert(abs(metalAttenuation[i] - exact.metalAttenuation) <= 1e-7 * exact.metalAttenuation);
+					assert(abs(totalAttenuation[i] - exact.totalAttenuation) <= 1e-7 * exact.totalAttenuation);
+				}
+
+				//           
+				double logWavelength[997], logDielectric[997], logMetal[997], logTotal[997];
+				sweepLogarithmic(design, debyeTable, 1e6, 1e11, span<double const>(frequencies),
+					SweepOutputs{ logWavelength, logDielectric, logMetal, logTotal });
+				for (std::size_t i = 0; i < 997; ++i) {
+					assert(abs(logWavelength[i] - wavelength[i]) <= 1e-11 * wavelength[i]);
+					assert(abs(logDielectric[i] - dielectricAttenuation[i]) <= 1e-11 * dielectricAttenuation[i]);
+					assert(abs(logMetal[i] - metalAttenuation[i]) <= 1e-11 * metalAttenuation[i]);
+					assert(abs(logTotal[i] - totalAttenuation[i]) <= 1e-11 * totalAttenuation[i]);
+				}
+				//      -   
+				bool mismatched = false;
+				try {
+					sweepLogarithmic(design, debyeTable, 1e6, 1e11, span<double const>(frequencies, 500), SweepOutputs{ {}, {}, {}, span<double>(logTotal, 500) });
+				}
+				catch (exception const&) {
+					mismatched = true;
+				}
+				assert(mismatched);
+
+				//  
+				double const outside[] = { 1e9, 2e11 };
+				bool thrown = false;
+				try {
+					sweepFrequency(design, debyeTable, span<double const>(outside), SweepOutputs{ {}, {}, {}, span<double>(totalAttenuation, 2) });
+				}
+				catch (exception const& e) {
+					thrown = e.code() == error::frequency;
+				}
+				assert(thrown);
+			}
+		} test_Dielectric;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
@@ -0,0 +1,273 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialBatch.h"
+#include <limits>
+
+//  ( ):      
+//dual<Real, N>      N ;   sqrt/log     .
+// (evaluate)   (batch::compute)     ,   Real = dual<double, 7>
+//             
+//( 14           ).
+//       basicDesign: d, D, frequency, sigma, epsilon, Ep, tanDelta (. input).
+// (   )   .
+//       autodiff: sqrt, log, exp, abs       
+//          Coaxial.
+
+namespace Coaxial {
+	namespace autodiff {
+		// :   
+		//Real -      (float, double, long double)
+		//N -  ,    
+		template<typename Real, std::size_t N>
+		struct dual {
+			//
+			Real value;
+			//   
+			Real gradient[N];
+
+			// 
+			dual() noexcept :value(0), gradient{} {}
+			//  ( )
+			//value - 
+			dual(Real const value) noexcept :value(value), gradient{} {}
+			//   (    index)
+			//value - 
+			//index -  
+			dual(Real const value, std::size_t const index) noexcept :value(value), gradient{} {
+				gradient[index] = Real(1);
+			}
+
+			dual& operator+=(dual const& other) noexcept {
+				value += other.value;
+				for (std::size_t k = 0; k < N; ++k)
+					gradient[k] += other.gradient[k];
+				return *this;
+			}
+			dual& operator-=(dual const& other) noexcept {
+				value -= other.value;
+				for (std::size_t k = 0; k < N; ++k)
+					gradient[k] -= other.gradient[k];
+				return *this;
+			}
+			//(uv)' = u'v + uv'
+			dual& operator*=(dual const& other) noexcept {
+				for (std::size_t k = 0; k < N; ++k)
+					gradient[k] = gradient[k] * other.value + value * other.gradient[k];
+				value *= other.value;
+				return *this;
+			}
+			//(u/v)' = (u' - (u/v)v') / v
+			dual& operator/=(dual const& other) noexcept {
+				Real const inverse = Real(1) / other.value;
+				value *= inverse;
+				for (std::size_t k = 0; k < N; ++k)
+					gradient[k] = (gradient[k] - value * other.gradient[k]) * inverse;
+				return *this;
+			}
+
+			//   ,    Real   dual 
+			friend dual operator+(dual left, dual const& right) noexcept {
+				return left += right;
+			}
+			friend dual operator-(dual left, dual const& right) noexcept {
+				return left -= right;
+			}
+			friend dual operator*(dual left, dual const& right) noexcept {
+				return left *= right;
+			}
+			friend dual operator/(dual left, dual const& right) noexcept {
+				return left /= right;
+			}
+			friend dual operator-(dual operand) noexcept {
+				operand.value = -operand.value;
+				for (std::size_t k = 0; k < N; ++k)
+					operand.gradient[k] = -operand.gradient[k];
+				return operand;
+			}
+
+			friend bool operator<(dual const& left, dual const& right) noexcept {
+				return left.value < right.value;
+			}
+			friend bool operator<=(dual const& left, dual const& right) noexcept {
+				return left.value <= right.value;
+			}
+			friend bool operator>(dual const& left, dual const& right) noexcept {
+				return left.value > right.value;
+			}
+			friend bool operator>=(dual const& left, dual const& right) noexcept {
+				return left.value >= right.value;
+			}
+			friend bool operator==(dual const& left, dual const& right) noexcept {
+				return left.value == right.value;
+			}
+			friend bool operator!=(dual const& left, dual const& right) noexcept {
+				return left.value != right.value;
+			}
+		};
+
+		//    : f(u)' = f'(u) * u'
+		//x - 
+		//value - f(x.value)
+		//derivative - f'(x.value)
+		template<typename Real, std::size_t N>
+		dual<Real, N> chain(dual<Real, N> const& x, Real const value, Real const derivative) noexcept {
+			dual<Real, N> result(value);
+			for (std::size_t k = 0; k < N; ++k)
+				result.gradient[k] = derivative * x.gradient[k];
+			return result;
+		}
+
+		// : (sqrt u)' = u' / (2 sqrt u)
+		//x - 
+		template<typename Real, std::size_t N>
+		dual<Real, N> sqrt(dual<Real, N> const& x) noexcept {
+			using std::sqrt;
+			Real const root = sqrt(x.value);
+			return chain(x, root, Real(0.5) / root);
+		}
+
+		// : (log u)' = u' / u
+		//x - 
+		template<typename Real, std::size_t N>
+		dual<Real, N> log(dual<Real, N> const& x) noexcept {
+			using std::log;
+			return chain(x, log(x.value), Real(1) / x.value);
+		}
+
+		//: (exp u)' = exp(u) u'
+		//x - 
+		template<typename Real, std::size_t N>
+		dual<Real, N> exp(dual<Real, N> const& x) noexcept {
+			using std::exp;
+			Real const power = exp(x.value);
+			return chain(x, power, power);
+		}
+
+		// (    )
+		//x - 
+		template<typename Real, std::size_t N>
+		dual<Real, N> abs(dual<Real, N> const& x) noexcept {
+			return x.value < Real(0) ? -x : x;
+		}
+
+		//   (  basicDesign)
+		enum class input : std::size_t {
+			d,
+			D,
+			frequency,
+			sigma,
+			epsilon,
+			Ep,
+			tanDelta
+		};
+
+		//         
+		using sensitivity = dual<double, 7>;
+
+		//   
+		//x -  
+		//variable - 
+		template<typename Real, std::size_t N>
+		Real derivative(dual<Real, N> const& x, input const variable) noexcept {
+			return x.gradient[static_cast<std::size_t>(variable)];
+		}
+
+		//     (    )
+		//design -  
+		template<typename Real>
+		basicDesign<dual<Real, 7>> seed(basicDesign<Real> const& design) noexcept {
+			using variable = dual<Real, 7>;
+			return { variable(design.d, 0), variable(design.D, 1), variable(design.frequency, 2), variable(design.sigma, 3),
+				variable(design.epsilon, 4), variable(design.Ep, 5), variable(design.tanDelta, 6) };
+		}
+
+		//          
+		//design -  
+		template<typename Real>
+		basicResults<dual<Real, 7>> sensitivities(basicDesign<Real> const& design) {
+			return evaluate(seed(design));
+		}
+
+#ifdef _DEBUG
+		// :        
+		class testDual {
+			//  
+			//value -    
+			//expected -  
+			//bound -   
+			static void checkClose(double value, double expected, double bound) {
+				double const delta = std::abs(value - expected);
+				assert(delta <= bound * std::abs(expected) || delta <= 1e-300);
+			}
+		public:
+			testDual() {
+				test();
+			}
+
+			static void test() {
+				Design const design{ 2.1e-3, 7.3e-3, 1e10, 6.1e7, 2.08, 2.5e7, 2.5e-4 };
+				basicResults<sensitivity> const result = sensitivities(design);
+
+				// : Z = 60 / sqrt(epsilon) * ln(D/d)
+				checkClose(derivative(result.waveResistance, input::d), -60.0 / (std::sqrt(design.epsilon) * design.d), 1e-14);
+				checkClose(derivative(result.waveResistance, input::D), 60.0 / (std::sqrt(design.epsilon) * design.D), 1e-14);
+				checkClose(result.waveResistance.value, evaluate(design).waveResistance, 1e-15);
+				//    1 / sqrt(sigma): d(alpha_m)/d(sigma) = -alpha_m / (2 sigma)
+				checkClose(derivative(result.metalAttenuation, input::sigma), -result.metalAttenuation.value / (2.0 * design.sigma), 1e-14);
+
+				//    :      1e-6
+				double Design::* const inputs[] = { &Design::d, &Design::D, &Design::frequency, &Design::sigma,
+					&Design::epsilon, &Design::Ep, &Design::tanDelta };
+				sensitivity basicResults<sensitivity>::* const outputs[] = { &basicResults<sensitivity>::wavelength,
+					&basicResults<sensitivity>::phaseSpeed, &basicResults<sensitivity>::characteristicResistance,
+					&basicResults<sensitivity>::dielectricAttenuation, &basicResults<sensitivity>::metalAttenuation,
+					&basicResults<sensitivity>::totalAttenuation, &basicResults<sensitivity>::waveResistance,
+					&basicResults<sensitivity>::peakVoltage, &basicResults<sensitivity>::peakPower };
+				double Results::* const plain[] = { &Results::wavelength, &Results::phaseSpeed, &Results::characteristicResistance,
+					&Results::dielectricAttenuation, &Results::metalAttenuation, &Results::totalAttenuation,
+					&Results::waveResistance, &Results::peakVoltage, &Results::peakPower };
+				for (std::size_t k = 0; k < 7; ++k) {
+					Design up = design, down = design;
+					double const step = design.*inputs[k] * 1e-6;
+					up.*inputs[k] += step;
+					down.*inputs[k] -= step;
+					Results const upper = evaluate(up), lower = evaluate(down);
+					for (std::size_t m = 0; m < 9; ++m) {
+						double const difference = (upper.*plain[m] - lower.*plain[m]) / (2.0 * step);
+						double const scale = std::abs((result.*outputs[m]).value) / (design.*inputs[k]);
+						double const delta = std::abs((result.*outputs[m]).gradient[k] - difference);
+						assert(delta <= 1e-6 * scale);
+					}
+				}
+
+				//        
+				basicDesign<sensitivity> const seeded = seed(design);
+				sensitivity const d[] = { seeded.d }, D[] = { seeded.D }, frequency[] = { seeded.frequency }, sigma[] = { seeded.sigma },
+					epsilon[] = { seeded.epsilon }, Ep[] = { seeded.Ep }, tanDelta[] = { seeded.tanDelta };
+				sensitivity columns[9][1];
+				batch::compute(batch::basicInputs<sensitivity>{ d, D, frequency, sigma, epsilon, Ep, tanDelta },
+					batch::basicOutputs<sensitivity>{ columns[0], columns[1], columns[2], columns[3], columns[4], columns[5],
+					columns[6], columns[7], columns[8], {}, {} });
+				for (std::size_t k = 0; k < 7; ++k) {
+					checkClose(columns[5][0].gradient[k], result.totalAttenuation.gradient[k], 1e-13);
+					checkClose(columns[8][0].gradient[k], result.peakPower.gradient[k], 1e-13);
+				}
+			}
+		} test_Dual;
+#endif // _DEBUG
+	}
+}
+
+namespace std {
+	//   ( batch::tryCompute  NaN   )
+	template<typename Real, std::size_t N>
+	class numeric_limits<Coaxial::autodiff::dual<Real, N>> : public numeric_limits<Real> {
+	public:
+		static Coaxial::autodiff::dual<Real, N> quiet_NaN() noexcept {
+			Coaxial::autodiff::dual<Real, N> result(numeric_limits<Real>::quiet_NaN());
+			for (std::size_t k = 0; k < N; ++k)
+				result.gradient[k] = numeric_limits<Real>::quiet_NaN();
+			return result;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialBatch.h"
+#include <cstring>
+
+//      
+//   7-  (   2 * atanh(s), s = (m - 1) / (m + 1))  
+//  [sqrt(1/2), sqrt(2))   ,        .
+//   :      .
+// :   log   1e-7 (  s^8 / 9  |s| <= 0.1716),
+//   -   1e-6      
+//( log        3/2 -   ).
+//  -  testFast  (    ,  D/d -> 1).
+//batch::computeUnchecked<fast::math>  (SSE2/AVX2/AVX-512)      ;
+//  fast::evaluate   :        ,   .
+//    (   ) -  benchmarks.cpp ( CoaxialBenchmarks).
+
+namespace Coaxial {
+	namespace fast {
+		//       1e-7
+		//x -  (,  0,  )
+		double log(double const x) noexcept {
+			constexpr double ln2 = 0.693147180559945309417;
+
+			std::uint64_t bits;
+			std::memcpy(&bits, &x, sizeof bits);
+			//    1  sqrt(1/2):      k,     sqrt(1/2)
+			//  [sqrt(1/2), sqrt(2)) -     ,  
+			constexpr std::uint64_t sqrtHalfBits = 0x3FE6A09E667F3BCDull;
+			bits += 0x3FF0000000000000ull - sqrtHalfBits;
+			//   double    2^52
+			//( int64 -> double    AVX-512)
+			std::uint64_t const exponentBits = (bits >> 52) | 0x4330000000000000ull;
+			double exponent;
+			std::memcpy(&exponent, &exponentBits, sizeof exponent);
+			exponent -= 4503599627370496.0 + 1023.0;
+			bits = (bits & 0x000FFFFFFFFFFFFFull) + sqrtHalfBits;
+			double m;
+			std::memcpy(&m, &bits, sizeof m);
+
+			double const s = (m - 1.0) / (m + 1.0);
+			double const z = s * s;
+			double const series = s * (2.0 + z * (2.0 / 3.0 + z * (2.0 / 5.0 + z * (2.0 / 7.0))));
+			return exponent * ln2 + series;
+		}
+
+		//     ( ;    )
+		//x - 
+		float log(float const x) noexcept {
+			return static_cast<float>(fast::log(static_cast<double>(x)));
+		}
+
+		//     ( :  1e-7    )
+		//x - 
+		long double log(long double const x) noexcept {
+			return fast::log(static_cast<double>(x));
+		}
+
+		//      evaluate  batch::compute
+		struct math {
+			//  ()
+			//x - 
+			template<typename Real>
+			static Real sqrt(Real const x) noexcept {
+				using std::sqrt;
+				return sqrt(x);
+			}
+			//  ()
+			//x - 
+			template<typename Real>
+			static Real log(Real const x) noexcept {
+				return fast::log(x);
+			}
+		};
+
+		//       (   ,  Coaxial::evaluate)
+		//design -  
+		template<typename Real>
+		basicResults<Real> evaluate(basicDesign<Real> const& design) {
+			return Coaxial::evaluate<math>(design);
+		}
+
+		//       (   ,  batch::compute)
+		//in -   
+		//out -  
+		template<typename Real>
+		void compute(batch::basicInputs<Real> const& in, batch::basicOutputs<Real> const& out) {
+			batch::compute<math>(in, out);
+		}
+
+#ifdef _DEBUG
+		//        
+		class testFast {
+			//  
+			//value -  
+			//exact -  
+			//bound -   
+			static void checkRelative(double value, double exact, double bound) {
+				double const delta = abs(value - exact);
+				assert(delta <= bound * abs(exact));
+			}
+		public:
+			testFast() {
+				test();
+			}
+
+			static void test() {
+				//:  D/d   1  ,     
+				for (double t = 1e-12; t < 1e12; t *= 1.0007)
+					checkRelative(fast::log(1.0 + t), std::log(1.0 + t), 1e-7);
+				for (double x = 1e-12; x < 1.0; x *= 1.0007)
+					checkRelative(fast::log(x), std::log(x), 1e-7);
+				//     
+				checkRelative(math::log(3.0f), std::log(3.0), 1e-7);
+				checkRelative(static_cast<double>(math::log(3.0L)), std::log(3.0), 1e-7);
+
+				// :      
+				double Results::* const outputs[] = { &Results::wavelength, &Results::phaseSpeed, &Results::characteristicResistance,
+					&Results::dielectricAttenuation, &Results::metalAttenuation, &Results::totalAttenuation,
+					&Results::waveResistance, &Results::peakVoltage, &Results::peakPower };
+				for (double ratio = 1.0 + 1e-9; ratio < 1e3; ratio = 1.0 + (ratio - 1.0) * 3.1)
+					for (double epsilon = 1.0; epsilon < 100.0; epsilon *= 2.3)
+						for (double frequency = 1e3; frequency < 1e12; frequency *= 17.0) {
+							Design const design{ 1e-3, 1e-3 * ratio, frequency, 5.8e7, epsilon, 3e7, 2e-4 };
+							Results const exact = Coaxial::evaluate(design);
+							Results const approximate = fast::evaluate(design);
+							for (double Results::* const member : outputs)
+								checkRelative(approximate.*member, exact.*member, 1e-6);
+						}
+			}
+		} test_Fast;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
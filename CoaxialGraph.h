@@ -0,0 +1,419 @@
+#pragma once
+#include "Coaxial.h"
+#include <cstdint>
+
+//   Coaxial.h     
+// -    (sqrt(epsilon), log(D/d),   )    ,
+// -  evaluateUnchecked.          
+//(   ),      -   
+//      . ,  Ep  peakVoltage  peakPower,
+// tanDelta - dielectricAttenuation  totalAttenuation.
+//      evaluateUnchecked,     evaluate()    .
+//   (violations,  )    ;     -
+//    ,   evaluate.
+//  :   -  .
+//  -     (evaluations())     Math.     
+//         evaluate -  benchmarks.cpp ( CoaxialBenchmarks).
+
+namespace Coaxial {
+	namespace graph {
+		// 
+		enum class input : std::uint8_t {
+			d,
+			D,
+			frequency,
+			sigma,
+			epsilon,
+			Ep,
+			tanDelta
+		};
+
+		// 
+		enum class output : std::uint8_t {
+			wavelength,
+			phaseSpeed,
+			characteristicResistance,
+			dielectricAttenuation,
+			metalAttenuation,
+			totalAttenuation,
+			waveResistance,
+			peakVoltage,
+			peakPower
+		};
+
+		namespace detail {
+			//    :   ,    (  output)
+			enum node : std::uint8_t {
+				sqrtEpsilon,
+				logRatio,
+				surfaceResistance,
+				firstOutput,
+				nodes = firstOutput + 9
+			};
+
+			//  ( n -  n)
+			using nodeMask = std::uint16_t;
+
+			//  
+			struct dependencies {
+				//  ( -  input)
+				std::uint8_t inputs;
+				//
+				nodeMask nodes;
+			};
+
+			// 
+			//n -  
+			constexpr nodeMask bit(int const n) noexcept {
+				return static_cast<nodeMask>(1u << n);
+			}
+
+			//  
+			//in -  
+			constexpr std::uint8_t bit(input const in) noexcept {
+				return static_cast<std::uint8_t>(1u << static_cast<int>(in));
+			}
+
+			//   
+			//out -  
+			constexpr int nodeOf(output const out) noexcept {
+				return firstOutput + static_cast<int>(out);
+			}
+
+			//  (  evaluateUnchecked)
+			constexpr dependencies direct[nodes] = {
+				//sqrtEpsilon = sqrt(epsilon)
+				{ bit(input::epsilon), 0 },
+				//logRatio = log(D / d)
+				{ static_cast<std::uint8_t>(bit(input::d) | bit(input::D)), 0 },
+				//surfaceResistance = sqrt(2 * pi * f * mu0 / (2 * sigma))
+				{ static_cast<std::uint8_t>(bit(input::frequency) | bit(input::sigma)), 0 },
+				//wavelength = c / f / sqrt(epsilon)
+				{ bit(input::frequency), bit(sqrtEpsilon) },
+				//phaseSpeed = c / sqrt(epsilon)
+				{ 0, bit(sqrtEpsilon) },
+				//characteristicResistance = 120 * pi / sqrt(epsilon)
+				{ 0, bit(sqrtEpsilon) },
+				//dielectricAttenuation = tanDelta * pi / wavelength * 8.68
+				{ bit(input::tanDelta), bit(nodeOf(output::wavelength)) },
+				//metalAttenuation = sqrt(epsilon) * (Rs / d + Rs / D) / (120 * pi * log(D / d)) * 8.68
+				{ static_cast<std::uint8_t>(bit(input::d) | bit(input::D)),
+					static_cast<nodeMask>(bit(sqrtEpsilon) | bit(logRatio) | bit(surfaceResistance)) },
+				//totalAttenuation = dielectricAttenuation + metalAttenuation
+				{ 0, static_cast<nodeMask>(bit(nodeOf(output::dielectricAttenuation)) | bit(nodeOf(output::metalAttenuation))) },
+				//waveResistance = 60 * log(D / d) / sqrt(epsilon)
+				{ 0, static_cast<nodeMask>(bit(sqrtEpsilon) | bit(logRatio)) },
+				//peakVoltage = Ep * D / 2 * log(D / d)
+				{ static_cast<std::uint8_t>(bit(input::Ep) | bit(input::D)), bit(logRatio) },
+				//peakPower = peakVoltage^2 / 120 * sqrt(epsilon / log(D / d))
+				{ bit(input::epsilon), static_cast<nodeMask>(bit(logRatio) | bit(nodeOf(output::peakVoltage))) }
+			};
+
+			// : ,       
+			//in -   
+			constexpr nodeMask affected(int const in) noexcept {
+				nodeMask mask = 0;
+				// :      
+				for (int n = 0; n < nodes; ++n)
+					if ((direct[n].inputs & (1u << in)) != 0 || (direct[n].nodes & mask) != 0)
+						mask |= bit(n);
+				return mask;
+			}
+
+			// :    ,    
+			//target -  
+			constexpr nodeMask ancestors(int const target) noexcept {
+				nodeMask mask = bit(target);
+				//  :       
+				for (int n = target; n >= 0; --n)
+					if ((mask & bit(n)) != 0)
+						mask |= direct[n].nodes;
+				return mask;
+			}
+
+			//  ( )
+			struct closures {
+				nodeMask byInput[7]{};
+				nodeMask byNode[nodes]{};
+
+				constexpr closures() noexcept {
+					for (int in = 0; in < 7; ++in)
+						byInput[in] = affected(in);
+					for (int n = 0; n < nodes; ++n)
+						byNode[n] = ancestors(n);
+				}
+			};
+
+			constexpr closures closure{};
+
+			static_assert(closure.byInput[static_cast<int>(input::Ep)] ==
+				(bit(nodeOf(output::peakVoltage)) | bit(nodeOf(output::peakPower))), "Ep       ");
+		}
+
+		//    
+		//Math -    (sqrt, log)
+		//Real -      (float, double, long double)
+		template<typename Real, typename Math = exactMath>
+		class basicGraph {
+			// 
+			basicDesign<Real> design_;
+			// 
+			Real values_[detail::nodes];
+			//,  
+			detail::nodeMask dirty_;
+			//     
+			errorMask errors_;
+			//   (  )
+			std::uint64_t evaluations_;
+
+			//  
+			//in -  
+			Real& field(input const in) noexcept {
+				switch (in) {
+				case input::d:
+					return design_.d;
+				case input::D:
+					return design_.D;
+				case input::frequency:
+					return design_.frequency;
+				case input::sigma:
+					return design_.sigma;
+				case input::epsilon:
+					return design_.epsilon;
+				case input::Ep:
+					return design_.Ep;
+				default:
+					return design_.tanDelta;
+				}
+			}
+
+			//   (    -   evaluateUnchecked)
+			//n -  
+			Real compute(int const n) const noexcept {
+				Real const pi = static_cast<Real>(M_PI);
+				Real const c = static_cast<Real>(lightSpeed);
+				Real const decibels = static_cast<Real>(8.68);
+				Real const* const v = values_;
+				switch (n) {
+				case detail::sqrtEpsilon:
+					return Math::sqrt(design_.epsilon);
+				case detail::logRatio:
+					return Math::log(design_.D / design_.d);
+				case detail::surfaceResistance: {
+					Real const omega = Real(2) * pi * design_.frequency;
+					return Math::sqrt((omega * static_cast<Real>(magneticConstant)) / (Real(2) * design_.sigma));
+				}
+				case detail::firstOutput + static_cast<int>(output::wavelength):
+					return c / design_.frequency / v[detail::sqrtEpsilon];
+				case detail::firstOutput + static_cast<int>(output::phaseSpeed):
+					return c / v[detail::sqrtEpsilon];
+				case detail::firstOutput + static_cast<int>(output::characteristicResistance):
+					return Real(120) * pi / v[detail::sqrtEpsilon];
+				case detail::firstOutput + static_cast<int>(output::dielectricAttenuation):
+					return design_.tanDelta * pi / v[detail::nodeOf(output::wavelength)] * decibels;
+				case detail::firstOutput + static_cast<int>(output::metalAttenuation): {
+					Real const R_superficial = v[detail::surfaceResistance];
+					return v[detail::sqrtEpsilon] * (R_superficial / design_.d + R_superficial / design_.D) /
+						(Real(120) * pi * v[detail::logRatio]) * decibels;
+				}
+				case detail::firstOutput + static_cast<int>(output::totalAttenuation):
+					return v[detail::nodeOf(output::dielectricAttenuation)] + v[detail::nodeOf(output::metalAttenuation)];
+				case detail::firstOutput + static_cast<int>(output::waveResistance):
+					return Real(60) * v[detail::logRatio] / v[detail::sqrtEpsilon];
+				case detail::firstOutput + static_cast<int>(output::peakVoltage):
+					return design_.Ep * (design_.D / Real(2)) * v[detail::logRatio];
+				default: {
+					Real const u = v[detail::nodeOf(output::peakVoltage)];
+					return (u * u / Real(120)) * Math::sqrt(design_.epsilon / v[detail::logRatio]);
+				}
+				}
+			}
+
+			// ,     
+			//mask -   
+			//n -   (:   switch  compute    )
+			void refreshNode(detail::nodeMask const mask, int const n) noexcept {
+				if ((mask & detail::bit(n)) != 0)
+					values_[n] = compute(n);
+			}
+
+			//       
+			//  :            evaluate
+			//mask - ,  
+			void refresh(detail::nodeMask mask) noexcept {
+				mask &= dirty_;
+				if (mask == 0)
+					return;
+				dirty_ &= static_cast<detail::nodeMask>(~mask);
+				for (detail::nodeMask bits = mask; bits != 0; bits &= static_cast<detail::nodeMask>(bits - 1))
+					++evaluations_;
+				refreshNode(mask, 0);
+				refreshNode(mask, 1);
+				refreshNode(mask, 2);
+				refreshNode(mask, 3);
+				refreshNode(mask, 4);
+				refreshNode(mask, 5);
+				refreshNode(mask, 6);
+				refreshNode(mask, 7);
+				refreshNode(mask, 8);
+				refreshNode(mask, 9);
+				refreshNode(mask, 10);
+				refreshNode(mask, 11);
+				static_assert(detail::nodes == 12, "   refresh    detail::node");
+			}
+
+			//     
+			void check() const {
+				if (errors_ != 0)
+					throw exception(firstError(errors_));
+			}
+		public:
+			//
+			//design -    (      )
+			explicit basicGraph(basicDesign<Real> const& design) noexcept :design_(design), values_{},
+				dirty_(static_cast<detail::nodeMask>(detail::bit(detail::nodes) - 1)), errors_(violations(design)), evaluations_(0) {}
+
+			//   ;    (      )
+			//in -  
+			//value -  
+			void set(input const in, Real const value) noexcept {
+				Real& target = field(in);
+				if (target == value)
+					return;
+				target = value;
+				dirty_ |= detail::closure.byInput[static_cast<int>(in)];
+				errors_ = violations(design_);
+			}
+
+			//   ;  ,    
+			//design -  
+			void set(basicDesign<Real> const& design) noexcept {
+				set(input::d, design.d);
+				set(input::D, design.D);
+				set(input::frequency, design.frequency);
+				set(input::sigma, design.sigma);
+				set(input::epsilon, design.epsilon);
+				set(input::Ep, design.Ep);
+				set(input::tanDelta, design.tanDelta);
+			}
+
+			//  
+			basicDesign<Real> const& design() const noexcept {
+				return design_;
+			}
+
+			//      (0 -  )
+			errorMask errors() const noexcept {
+				return errors_;
+			}
+
+			//  ;     
+			//out -  
+			Real get(output const out) {
+				check();
+				int const n = detail::nodeOf(out);
+				refresh(detail::closure.byNode[n]);
+				return values_[n];
+			}
+
+			//  ;    
+			basicResults<Real> results() {
+				check();
+				refresh(static_cast<detail::nodeMask>(detail::bit(detail::nodes) - 1));
+				Real const* const v = values_ + detail::firstOutput;
+				return { v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8] };
+			}
+
+			//      (  - 12 )
+			std::uint64_t evaluations() const noexcept {
+				return evaluations_;
+			}
+		};
+
+		//  -  
+		using Graph = basicGraph<double>;
+
+#ifdef _DEBUG
+		// :      evaluate
+		class testGraph {
+			//     
+			//graph - 
+			static void checkSame(Graph& graph) {
+				Results const expected = Coaxial::evaluate(graph.design());
+				Results const actual = graph.results();
+				double Results::* const outputs[] = { &Results::wavelength, &Results::phaseSpeed, &Results::characteristicResistance,
+					&Results::dielectricAttenuation, &Results::metalAttenuation, &Results::totalAttenuation,
+					&Results::waveResistance, &Results::peakVoltage, &Results::peakPower };
+				for (double Results::* const member : outputs)
+					assert(actual.*member == expected.*member);
+			}
+		public:
+			testGraph() {
+				test();
+			}
+
+			static void test() {
+				Graph graph(Design{ 2.1e-3, 7.3e-3, 1e10, 6.1e7, 2.08, 2.5e7, 2.5e-4 });
+				checkSame(graph);
+				assert(graph.evaluations() == 12);
+
+				//Ep:    
+				graph.set(input::Ep, 3e7);
+				checkSame(graph);
+				assert(graph.evaluations() == 14);
+				//  Ep -  
+				graph.set(input::Ep, 3e7);
+				checkSame(graph);
+				assert(graph.evaluations() == 14);
+				//tanDelta:     
+				graph.set(input::tanDelta, 1e-3);
+				checkSame(graph);
+				assert(graph.evaluations() == 16);
+				//epsilon: ,   , log(D/d)   
+				graph.set(input::epsilon, 2.25);
+				checkSame(graph);
+				assert(graph.evaluations() == 25);
+
+				//      
+				graph.set(input::D, 8e-3);
+				graph.get(output::peakVoltage);
+				assert(graph.evaluations() == 27);
+				checkSame(graph);
+				assert(graph.evaluations() == 31);
+
+				// :   ,   
+				graph.set(input::D, 1e-3);
+				assert(graph.errors() == errorBit(error::diameters));
+				error thrown = error::none;
+				try {
+					graph.results();
+				}
+				catch (exception const& e) {
+					thrown = e.code();
+				}
+				assert(thrown == error::diameters);
+				graph.set(input::D, 7.3e-3);
+				checkSame(graph);
+
+				//    
+				double const scale[] = { 0.999, 1.0013 };
+				for (int i = 0; i < 3000; ++i) {
+					input const in = static_cast<input>(i % 7);
+					Design const current = graph.design();
+					double const values[] = { current.d, current.D, current.frequency, current.sigma, current.epsilon, current.Ep, current.tanDelta };
+					double value = values[i % 7] * scale[(i / 7) % 2];
+					if (in == input::d && value >= current.D)
+						continue;
+					if (in == input::epsilon && value < 1.0)
+						value = 1.0;
+					graph.set(in, value);
+					if (i % 5 == 0)
+						assert(graph.get(output::waveResistance) == Coaxial::evaluate(graph.design()).waveResistance);
+					else
+						checkSame(graph);
+				}
+			}
+		} test_Graph;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
@@ -0,0 +1,203 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialParallel.h"
+#include "CoaxialSpan.h"
+#include <algorithm>
+#include <vector>
+
+//          d x D ( )
+//  -  d,  -  D;       (row-major).
+//,      (log(d), 1/d)     (log(D), 1/D),     /:
+//log(D/d) = log(D) - log(d),      ,   -  ,     .
+//   ,    D <= d    -   ,
+//   ,         (  - NaN).
+//    (  32  x 1024 :     16      L1),
+//      .
+// ( 4096 x 4096,  ,      ) -  benchmarks.cpp ( CoaxialBenchmarks).
+//:     log(D/d)    1e-16 * |log(d)|,
+//. .  1e-16 * |log(d)| / log(D/d) ( d = 1   D/d >= 1.05 -   3e-14).
+
+namespace Coaxial {
+	namespace grid {
+		// ,  - rows * columns     ( )
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicOutputs {
+			// , 
+			span<Real> waveResistance;
+			//  , /
+			span<Real> metalAttenuation;
+		};
+
+		//  -  
+		using Outputs = basicOutputs<double>;
+
+		//      
+		struct tiling {
+			//  
+			std::size_t rows = 32;
+			//  
+			std::size_t columns = 1024;
+			//  (0 -    )
+			unsigned threads = 0;
+		};
+
+		namespace detail {
+			//  
+			//rowBegin, rowEnd -   
+			//columnBegin, columnEnd -   
+			//columns -     (   )
+			//valid -        D > d
+			template<typename Real>
+			void computeTile(std::size_t const rowBegin, std::size_t const rowEnd, std::size_t const columnBegin, std::size_t const columnEnd,
+				std::size_t const columns, Real const* logd, Real const* inverted, Real const* logD, Real const* invertedD,
+				std::size_t const* valid, Real const resistanceFactor, Real const metalFactor,
+				Real* waveResistance, Real* metalAttenuation) noexcept {
+				Real const nan = std::numeric_limits<Real>::quiet_NaN();
+				for (std::size_t i = rowBegin; i < rowEnd; ++i) {
+					std::size_t const split = std::min(std::max(valid[i], columnBegin), columnEnd);
+					Real const logRow = logd[i];
+					Real const invertedRow = inverted[i];
+					if (waveResistance != nullptr) {
+						Real* __restrict row = waveResistance + i * columns;
+						for (std::size_t j = columnBegin; j < split; ++j)
+							row[j] = nan;
+						for (std::size_t j = split; j < columnEnd; ++j)
+							row[j] = resistanceFactor * (logD[j] - logRow);
+					}
+					if (metalAttenuation != nullptr) {
+						Real* __restrict row = metalAttenuation + i * columns;
+						for (std::size_t j = columnBegin; j < split; ++j)
+							row[j] = nan;
+						for (std::size_t j = split; j < columnEnd; ++j)
+							row[j] = metalFactor * (invertedRow + invertedD[j]) / (logD[j] - logRow);
+					}
+				}
+			}
+		}
+
+		//          d x D
+		//  D <= d  NaN
+		//Math -    (sqrt, log)
+		//d -     (), ,  
+		//D -    (), ,  
+		//frequency -   , 
+		//sigma -  , /
+		//epsilon -   
+		//out -   (d.size() * D.size()   )
+		//tiles -      
+		template<typename Math = exactMath, typename Real>
+		void compute(span<Real const> const d, span<Real const> const D, Real const frequency, Real const sigma, Real const epsilon,
+			basicOutputs<Real> const& out, tiling const& tiles = tiling()) {
+			if (frequency <= Real(0))
+				throw exception(error::frequency);
+			if (sigma <= Real(0))
+				throw exception(error::sigma);
+			if (epsilon < Real(1))
+				throw exception(error::epsilon);
+			if (!d.empty() && d[0] <= Real(0))
+				throw exception(error::innerDiameter);
+			if (!std::is_sorted(d.begin(), d.end()) || !std::is_sorted(D.begin(), D.end()))
+				throw exception(L"         ");
+
+			std::size_t const rows = d.size();
+			std::size_t const columns = D.size();
+			if ((!out.waveResistance.empty() && out.waveResistance.size() != rows * columns) ||
+				(!out.metalAttenuation.empty() && out.metalAttenuation.size() != rows * columns))
+				throw exception(L"       d.size() * D.size() ");
+			if (rows == 0 || columns == 0 || tiles.rows == 0 || tiles.columns == 0)
+				return;
+
+			Real const pi = static_cast<Real>(M_PI);
+			Real const sqrtEpsilon = Math::sqrt(epsilon);
+			//  , 
+			Real const R_superficial = Math::sqrt((Real(2) * pi * frequency * static_cast<Real>(magneticConstant)) / (Real(2) * sigma));
+			Real const resistanceFactor = Real(60) / sqrtEpsilon;
+			Real const metalFactor = sqrtEpsilon * R_superficial / (Real(120) * pi) * static_cast<Real>(8.68);
+
+			//   
+			std::vector<Real> logd(rows), inverted(rows), logD(columns), invertedD(columns);
+			std::vector<std::size_t> valid(rows);
+			for (std::size_t i = 0; i < rows; ++i) {
+				logd[i] = Math::log(d[i]);
+				inverted[i] = Real(1) / d[i];
+				valid[i] = static_cast<std::size_t>(std::upper_bound(D.begin(), D.end(), d[i]) - D.begin());
+			}
+			for (std::size_t j = 0; j < columns; ++j) {
+				logD[j] = Math::log(D[j]);
+				invertedD[j] = Real(1) / D[j];
+			}
+
+			std::size_t const tileRows = (rows + tiles.rows - 1) / tiles.rows;
+			std::size_t const tileColumns = (columns + tiles.columns - 1) / tiles.columns;
+			std::size_t const tileCount = tileRows * tileColumns;
+			parallel::forEach(tileCount, tiles.threads, [&](std::size_t const tile) noexcept {
+				std::size_t const rowBegin = tile / tileColumns * tiles.rows;
+				std::size_t const columnBegin = tile % tileColumns * tiles.columns;
+				detail::computeTile(rowBegin, std::min(rowBegin + tiles.rows, rows), columnBegin, std::min(columnBegin + tiles.columns, columns),
+					columns, logd.data(), inverted.data(), logD.data(), invertedD.data(), valid.data(), resistanceFactor, metalFactor,
+					out.waveResistance.empty() ? nullptr : out.waveResistance.data(),
+					out.metalAttenuation.empty() ? nullptr : out.metalAttenuation.data());
+			});
+		}
+
+#ifdef _DEBUG
+		// :    ,  ,     
+		class testGrid {
+			//  
+			//value -  
+			//expected -   
+			static void checkClose(double value, double expected) {
+				double const delta = abs(value - expected);
+				assert(delta <= 1e-12 * abs(expected));
+			}
+		public:
+			testGrid() {
+				test();
+			}
+
+			static void test() {
+				double const d[] = { 0.5e-3, 1e-3, 2.1e-3, 3e-3, 4e-3 };
+				double const D[] = { 1e-3, 2e-3, 3e-3, 4.86e-3, 7.3e-3, 1e-2, 2e-2 };
+				double const frequency = 1e9, sigma = 5.8e7, epsilon = 2.08;
+				double waveResistance[5 * 7], metalAttenuation[5 * 7];
+
+				// 2 x 3    -    
+				tiling tiles;
+				tiles.rows = 2;
+				tiles.columns = 3;
+				tiles.threads = 3;
+				compute(span<double const>(d), span<double const>(D), frequency, sigma, epsilon, Outputs{ waveResistance, metalAttenuation }, tiles);
+				for (std::size_t i = 0; i < 5; ++i)
+					for (std::size_t j = 0; j < 7; ++j) {
+						double const resistance = waveResistance[i * 7 + j];
+						double const metal = metalAttenuation[i * 7 + j];
+						if (D[j] <= d[i]) {
+							assert(resistance != resistance && metal != metal);
+							continue;
+						}
+						checkClose(resistance, Coaxial::waveResistance(epsilon, d[i], D[j]));
+						checkClose(metal, attenuationCoefficientInMetal(frequency, sigma, epsilon, d[i], D[j]));
+					}
+
+				// ,   
+				double single[5 * 7];
+				compute(span<double const>(d), span<double const>(D), frequency, sigma, epsilon, Outputs{ single, {} });
+				for (std::size_t k = 0; k < 5 * 7; ++k)
+					assert(single[k] == waveResistance[k] || (single[k] != single[k] && waveResistance[k] != waveResistance[k]));
+
+				// 
+				double const unsorted[] = { 2e-3, 1e-3 };
+				bool thrown = false;
+				try {
+					compute(span<double const>(unsorted), span<double const>(D), frequency, sigma, epsilon, Outputs{ {}, {} });
+				}
+				catch (exception const&) {
+					thrown = true;
+				}
+				assert(thrown);
+			}
+		} test_Grid;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
@@ -0,0 +1,485 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialSpan.h"
+#include <algorithm>
+#include <limits>
+
+// :           
+//    ( ),  - ,       .
+//    ,        (d -  1/d   log(D/d)),
+//      :
+//  log(D/d)   D    d, sqrt -  ;
+//   ,    ,       ;
+//     = sqrt(epsilon) * sqrt(pi * f * mu0 / sigma) * 8.68 / (120 * pi) * g(d, D), g = (1/d + 1/D) / log(D/d) = k(D/d) / D,
+//  k(x) = (x + 1) / log(x)   x* = 3.5911... ( log(x) = 1 + 1/x, k(x*) = x*)    ,
+//   g   d   D,   g -      d  D = D.lower,
+//   -  D = D.upper  x* ( D.upper / d.upper <= x* <= D.upper / d.lower)    .
+//  . log(D/d)    D/d -> 1:  ulp   D/d 
+//    eps / log(D/d),       
+//(nextafter;    , log   -   1 ulp,   glibc  MSVC).
+//  - , ,     ,   
+//  eps/2 ,       16 eps (      ).
+
+namespace Coaxial {
+	namespace intervals {
+		//  [lower, upper]
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct interval {
+			// 
+			Real lower;
+			// 
+			Real upper;
+
+			// 
+			Real width() const noexcept {
+				return upper - lower;
+			}
+			//   
+			//x - 
+			bool contains(Real const x) const noexcept {
+				return lower <= x && x <= upper;
+			}
+		};
+
+		//  -  
+		using Interval = interval<double>;
+		//  -       
+		using Box = basicDesign<Interval>;
+		//  
+		using Bounds = basicResults<Interval>;
+
+		//    
+		//nominal -  
+		//tolerance -  
+		template<typename Real>
+		interval<Real> around(Real const nominal, Real const tolerance) noexcept {
+			return { nominal - tolerance, nominal + tolerance };
+		}
+
+		namespace detail {
+			//  ,     
+			// ,        (. logRatio)
+			//lower, upper - ,     
+			template<typename Real>
+			interval<Real> outward(Real const lower, Real const upper) noexcept {
+				using std::abs;
+				Real const margin = Real(16) * std::numeric_limits<Real>::epsilon();
+				return { lower - abs(lower) * margin, upper + abs(upper) * margin };
+			}
+
+			//,      
+			//value - 
+			template<typename Real>
+			void checkOrder(interval<Real> const& value) {
+				if (!(value.lower <= value.upper))
+					throw exception(error::bounds);
+			}
+
+			//   numerator / denominator (  )
+			//numerator, denominator -   
+			template<typename Real>
+			interval<Real> ratio(Real const numerator, Real const denominator) noexcept {
+				using std::nextafter;
+				Real const quotient = numerator / denominator;
+				return { nextafter(quotient, Real(0)), nextafter(quotient, std::numeric_limits<Real>::infinity()) };
+			}
+
+			//  log(numerator / denominator)  numerator > denominator
+			//numerator, denominator -   
+			template<typename Real>
+			interval<Real> logRatio(Real const numerator, Real const denominator) noexcept {
+				using std::log;
+				using std::nextafter;
+				Real const infinity = std::numeric_limits<Real>::infinity();
+				interval<Real> const x = ratio(numerator, denominator);
+				//  -  ,   log     
+				Real lower = nextafter(nextafter(log(x.lower), -infinity), -infinity);
+				Real const upper = nextafter(nextafter(log(x.upper), infinity), infinity);
+				//  1,   
+				lower = lower > Real(0) ? lower : Real(0);
+				return { lower, upper };
+			}
+
+			// (x + 1) / log(x) -        x = numerator / denominator
+			//(  ,  D/d   1   ulp)
+			//numerator, denominator -   
+			template<typename Real>
+			interval<Real> ratioFactor(Real const numerator, Real const denominator) noexcept {
+				interval<Real> const x = ratio(numerator, denominator);
+				interval<Real> const logarithm = logRatio(numerator, denominator);
+				return { (x.lower + Real(1)) / logarithm.upper, (x.upper + Real(1)) / logarithm.lower };
+			}
+		}
+
+		//      :       
+		//    (0 -  )
+		//box -  
+		template<typename Real>
+		errorMask violations(basicDesign<interval<Real>> const& box) noexcept {
+			bool const inverted = !(box.d.lower <= box.d.upper) || !(box.D.lower <= box.D.upper) || !(box.frequency.lower <= box.frequency.upper) ||
+				!(box.sigma.lower <= box.sigma.upper) || !(box.epsilon.lower <= box.epsilon.upper) || !(box.Ep.lower <= box.Ep.upper) ||
+				!(box.tanDelta.lower <= box.tanDelta.upper);
+			return errorMask(
+				(errorMask(box.frequency.lower <= Real(0)) * errorBit(error::frequency)) |
+				(errorMask(box.epsilon.lower < Real(1)) * errorBit(error::epsilon)) |
+				(errorMask(box.tanDelta.lower <= Real(0)) * errorBit(error::tanDelta)) |
+				(errorMask(box.sigma.lower <= Real(0)) * errorBit(error::sigma)) |
+				(errorMask(box.D.lower <= box.d.upper) * errorBit(error::diameters)) |
+				(errorMask(box.d.lower <= Real(0)) * errorBit(error::innerDiameter)) |
+				(errorMask(box.Ep.lower <= Real(0)) * errorBit(error::electricStrength)) |
+				(errorMask(inverted) * errorBit(error::bounds)));
+		}
+
+		//   , 
+		//frequency - , 
+		//epsilon -  
+		template<typename Real>
+		interval<Real> wavelengthInTheLine(interval<Real> const& frequency, interval<Real> const& epsilon) {
+			using std::sqrt;
+			detail::checkOrder(frequency);
+			detail::checkOrder(epsilon);
+			if (frequency.lower <= Real(0))
+				throw exception(error::frequency);
+			if (epsilon.lower < Real(1))
+				throw exception(error::epsilon);
+
+			Real const c = static_cast<Real>(lightSpeed);
+			return detail::outward(c / frequency.upper / sqrt(epsilon.upper), c / frequency.lower / sqrt(epsilon.lower));
+		}
+
+		// , /
+		//epsilon -  
+		template<typename Real>
+		interval<Real> phaseSpeed(interval<Real> const& epsilon) {
+			using std::sqrt;
+			detail::checkOrder(epsilon);
+			if (epsilon.lower < Real(1))
+				throw exception(error::epsilon);
+
+			Real const c = static_cast<Real>(lightSpeed);
+			return detail::outward(c / sqrt(epsilon.upper), c / sqrt(epsilon.lower));
+		}
+
+		// , 
+		//epsilon -  
+		template<typename Real>
+		interval<Real> characteristicResistance(interval<Real> const& epsilon) {
+			using std::sqrt;
+			detail::checkOrder(epsilon);
+			if (epsilon.lower < Real(1))
+				throw exception(error::epsilon);
+
+			Real const factor = Real(120) * static_cast<Real>(M_PI);
+			return detail::outward(factor / sqrt(epsilon.upper), factor / sqrt(epsilon.lower));
+		}
+
+		//  , /
+		//tanDelta -   
+		//wavelength -  , 
+		template<typename Real>
+		interval<Real> attenuationCoefficientInDielectric(interval<Real> const& tanDelta, interval<Real> const& wavelength) {
+			detail::checkOrder(tanDelta);
+			detail::checkOrder(wavelength);
+			if (tanDelta.lower <= Real(0))
+				throw exception(error::tanDelta);
+			if (wavelength.lower <= Real(0))
+				throw exception(error::wavelength);
+
+			Real const factor = static_cast<Real>(M_PI) * static_cast<Real>(8.68);
+			return detail::outward(tanDelta.lower * factor / wavelength.upper, tanDelta.upper * factor / wavelength.lower);
+		}
+
+		//  , /
+		//frequency - , 
+		//sigma -  , /
+		//epsilon -  
+		//d -   , 
+		//D -  , 
+		template<typename Real>
+		interval<Real> attenuationCoefficientInMetal(interval<Real> const& frequency, interval<Real> const& sigma, interval<Real> const& epsilon,
+			interval<Real> const& d, interval<Real> const& D) {
+			using std::sqrt;
+			detail::checkOrder(frequency);
+			detail::checkOrder(sigma);
+			detail::checkOrder(epsilon);
+			detail::checkOrder(d);
+			detail::checkOrder(D);
+			if (frequency.lower <= Real(0))
+				throw exception(error::frequency);
+			if (sigma.lower <= Real(0))
+				throw exception(error::sigma);
+			if (epsilon.lower < Real(1))
+				throw exception(error::epsilon);
+			if (D.lower <= d.upper)
+				throw exception(error::diameters);
+			if (d.lower <= Real(0))
+				throw exception(error::innerDiameter);
+
+			Real const pi = static_cast<Real>(M_PI);
+			Real const factor = sqrt(pi * static_cast<Real>(magneticConstant)) / (Real(120) * pi) * static_cast<Real>(8.68);
+			//   :   f  epsilon,   sigma
+			Real const materialLower = factor * sqrt(epsilon.lower * frequency.lower / sigma.upper);
+			Real const materialUpper = factor * sqrt(epsilon.upper * frequency.upper / sigma.lower);
+
+			//  g = k(D/d) / D
+			Real const optimum = static_cast<Real>(3.5911214766686221366);
+			Real const geometryUpper = std::max(detail::ratioFactor(D.lower, d.upper).upper, detail::ratioFactor(D.lower, d.lower).upper) / D.lower;
+			Real const ratioLower = detail::ratio(D.upper, d.upper).lower;
+			Real const ratioUpper = detail::ratio(D.upper, d.lower).upper;
+			Real const geometryLower = (ratioLower <= optimum && optimum <= ratioUpper ? optimum :
+				std::min(detail::ratioFactor(D.upper, d.upper).lower, detail::ratioFactor(D.upper, d.lower).lower)) / D.upper;
+			return detail::outward(materialLower * geometryLower, materialUpper * geometryUpper);
+		}
+
+		// , /
+		//    f  epsilon,        ,    -  
+		//tanDelta -   
+		//frequency - , 
+		//sigma -  , /
+		//epsilon -  
+		//d -   , 
+		//D -  , 
+		template<typename Real>
+		interval<Real> totalAttenuationCoefficient(interval<Real> const& tanDelta, interval<Real> const& frequency, interval<Real> const& sigma,
+			interval<Real> const& epsilon, interval<Real> const& d, interval<Real> const& D) {
+			interval<Real> const dielectric = attenuationCoefficientInDielectric(tanDelta, wavelengthInTheLine(frequency, epsilon));
+			interval<Real> const metal = attenuationCoefficientInMetal(frequency, sigma, epsilon, d, D);
+			return detail::outward(dielectric.lower + metal.lower, dielectric.upper + metal.upper);
+		}
+
+		// , 
+		//epsilon -  
+		//d -   , 
+		//D -  , 
+		template<typename Real>
+		interval<Real> waveResistance(interval<Real> const& epsilon, interval<Real> const& d, interval<Real> const& D) {
+			using std::sqrt;
+			detail::checkOrder(epsilon);
+			detail::checkOrder(d);
+			detail::checkOrder(D);
+			if (epsilon.lower < Real(1))
+				throw exception(error::epsilon);
+			if (D.lower <= d.upper)
+				throw exception(error::diameters);
+			if (d.lower <= Real(0))
+				throw exception(error::innerDiameter);
+
+			return detail::outward(Real(60) * detail::logRatio(D.lower, d.upper).lower / sqrt(epsilon.upper),
+				Real(60) * detail::logRatio(D.upper, d.lower).upper / sqrt(epsilon.lower));
+		}
+
+		// , 
+		//Ep -  , /
+		//d -   , 
+		//D -  , 
+		template<typename Real>
+		interval<Real> peakVoltage(interval<Real> const& Ep, interval<Real> const& d, interval<Real> const& D) {
+			detail::checkOrder(Ep);
+			detail::checkOrder(d);
+			detail::checkOrder(D);
+			if (Ep.lower <= Real(0))
+				throw exception(error::electricStrength);
+			if (D.lower <= d.upper)
+				throw exception(error::diameters);
+			if (d.lower <= Real(0))
+				throw exception(error::innerDiameter);
+
+			return detail::outward(Ep.lower * (D.lower / Real(2)) * detail::logRatio(D.lower, d.upper).lower,
+				Ep.upper * (D.upper / Real(2)) * detail::logRatio(D.upper, d.lower).upper);
+		}
+
+		// , 
+		//u^2 / 120 * sqrt(epsilon / log(D/d)) = Ep^2 * D^2 * log(D/d)^1.5 * sqrt(epsilon) / 480 -   Ep, D, epsilon    d
+		//(   : log(D/d)   ,       D/d -> 1)
+		//epsilon -  
+		//Ep -  , /
+		//d -   , 
+		//D -  , 
+		template<typename Real>
+		interval<Real> peakPower(interval<Real> const& epsilon, interval<Real> const& Ep, interval<Real> const& d, interval<Real> const& D) {
+			using std::sqrt;
+			detail::checkOrder(epsilon);
+			detail::checkOrder(Ep);
+			detail::checkOrder(d);
+			detail::checkOrder(D);
+			if (epsilon.lower < Real(1))
+				throw exception(error::epsilon);
+			if (Ep.lower <= Real(0))
+				throw exception(error::electricStrength);
+			if (D.lower <= d.upper)
+				throw exception(error::diameters);
+			if (d.lower <= Real(0))
+				throw exception(error::innerDiameter);
+
+			Real const logLower = detail::logRatio(D.lower, d.upper).lower;
+			Real const logUpper = detail::logRatio(D.upper, d.lower).upper;
+			return detail::outward((Ep.lower * D.lower) * (Ep.lower * D.lower) * (logLower * sqrt(logLower)) * sqrt(epsilon.lower) / Real(480),
+				(Ep.upper * D.upper) * (Ep.upper * D.upper) * (logUpper * sqrt(logUpper)) * sqrt(epsilon.upper) / Real(480));
+		}
+
+		//     
+		//box -  
+		template<typename Real>
+		basicResults<interval<Real>> evaluate(basicDesign<interval<Real>> const& box) {
+			errorMask const mask = violations(box);
+			if (mask != 0)
+				throw exception(firstError(mask));
+
+			basicResults<interval<Real>> result;
+			result.wavelength = wavelengthInTheLine(box.frequency, box.epsilon);
+			result.phaseSpeed = phaseSpeed(box.epsilon);
+			result.characteristicResistance = characteristicResistance(box.epsilon);
+			result.dielectricAttenuation = attenuationCoefficientInDielectric(box.tanDelta, result.wavelength);
+			result.metalAttenuation = attenuationCoefficientInMetal(box.frequency, box.sigma, box.epsilon, box.d, box.D);
+			result.totalAttenuation = detail::outward(result.dielectricAttenuation.lower + result.metalAttenuation.lower,
+				result.dielectricAttenuation.upper + result.metalAttenuation.upper);
+			result.waveResistance = waveResistance(box.epsilon, box.d, box.D);
+			result.peakVoltage = peakVoltage(box.Ep, box.d, box.D);
+			result.peakPower = peakPower(box.epsilon, box.Ep, box.d, box.D);
+			return result;
+		}
+
+		//        -  
+		//     NaN,     
+		//   
+		//boxes -  
+		//results -  (   )
+		//masks -    (   )
+		template<typename Real>
+		std::size_t evaluate(span<basicDesign<interval<Real>> const> const boxes, span<basicResults<interval<Real>>> const results, span<errorMask> const masks) {
+			std::size_t const n = boxes.size();
+			if (results.size() != n || masks.size() != n)
+				throw exception(L"        ,    ");
+
+			Real const nan = std::numeric_limits<Real>::quiet_NaN();
+			interval<Real> const undefined{ nan, nan };
+			std::size_t invalid = 0;
+			for (std::size_t i = 0; i < n; ++i) {
+				masks[i] = violations(boxes[i]);
+				if (masks[i] != 0) {
+					++invalid;
+					results[i] = { undefined, undefined, undefined, undefined, undefined, undefined, undefined, undefined, undefined };
+					continue;
+				}
+				results[i] = evaluate(boxes[i]);
+			}
+			return invalid;
+		}
+
+#ifdef _DEBUG
+		//  :           
+		class testInterval {
+			//,     
+			//bounds - 
+			//value -    
+			//lower, upper -      
+			static void include(Interval const& bounds, double const value, double& lower, double& upper) {
+				assert(bounds.contains(value));
+				lower = std::min(lower, value);
+				upper = std::max(upper, value);
+			}
+			//  :      
+			//bounds - 
+			//lower, upper -      
+			static void tight(Interval const& bounds, double const lower, double const upper) {
+				assert(lower - bounds.lower <= 1e-13 * abs(lower) && bounds.upper - upper <= 1e-13 * abs(upper));
+			}
+		public:
+			testInterval() {
+				test();
+			}
+
+			static void test() {
+				//,   D/d    k(x) (x* = 3.59)
+				Box const box{ around(2.1e-3, 0.2e-3), around(7.3e-3, 0.3e-3), around(1e10, 1e9), around(5.8e7, 5e6),
+					around(2.08, 0.05), around(2.5e7, 1e6), around(2.5e-4, 2e-5) };
+				Bounds const bounds = evaluate(box);
+
+				double lower[9], upper[9];
+				std::fill(lower, lower + 9, std::numeric_limits<double>::infinity());
+				std::fill(upper, upper + 9, -std::numeric_limits<double>::infinity());
+				int const steps = 40;
+				for (int i = 0; i <= steps; ++i)
+					for (int j = 0; j <= steps; ++j)
+						for (int k = 0; k <= 2; ++k) {
+							//d  D -  ,   -   
+							double const t = k / 2.0;
+							Design const design{ box.d.lower + box.d.width() * i / steps, box.D.lower + box.D.width() * j / steps,
+								box.frequency.lower + box.frequency.width() * t, box.sigma.upper - box.sigma.width() * t,
+								box.epsilon.lower + box.epsilon.width() * t, box.Ep.lower + box.Ep.width() * t, box.tanDelta.lower + box.tanDelta.width() * t };
+							Results const value = Coaxial::evaluate(design);
+							include(bounds.wavelength, value.wavelength, lower[0], upper[0]);
+							include(bounds.phaseSpeed, value.phaseSpeed, lower[1], upper[1]);
+							include(bounds.characteristicResistance, value.characteristicResistance, lower[2], upper[2]);
+							include(bounds.dielectricAttenuation, value.dielectricAttenuation, lower[3], upper[3]);
+							include(bounds.metalAttenuation, value.metalAttenuation, lower[4], upper[4]);
+							include(bounds.totalAttenuation, value.totalAttenuation, lower[5], upper[5]);
+							include(bounds.waveResistance, value.waveResistance, lower[6], upper[6]);
+							include(bounds.peakVoltage, value.peakVoltage, lower[7], upper[7]);
+							include(bounds.peakPower, value.peakPower, lower[8], upper[8]);
+						}
+				tight(bounds.wavelength, lower[0], upper[0]);
+				tight(bounds.phaseSpeed, lower[1], upper[1]);
+				tight(bounds.characteristicResistance, lower[2], upper[2]);
+				tight(bounds.dielectricAttenuation, lower[3], upper[3]);
+				tight(bounds.waveResistance, lower[6], upper[6]);
+				tight(bounds.peakVoltage, lower[7], upper[7]);
+				tight(bounds.peakPower, lower[8], upper[8]);
+				//    ( ) -   d,      
+				for (int k = 4; k <= 5; ++k) {
+					Interval const& attenuation = k == 4 ? bounds.metalAttenuation : bounds.totalAttenuation;
+					assert(lower[k] - attenuation.lower <= 1e-5 * lower[k]);
+					assert(attenuation.upper - upper[k] <= 1e-13 * upper[k]);
+				}
+
+				//     
+				Design const point{ 2.1e-3, 7.3e-3, 1e10, 6.1e7, 2.08, 2.5e7, 2.5e-4 };
+				Box const degenerate{ { point.d, point.d }, { point.D, point.D }, { point.frequency, point.frequency }, { point.sigma, point.sigma },
+					{ point.epsilon, point.epsilon }, { point.Ep, point.Ep }, { point.tanDelta, point.tanDelta } };
+				Bounds const exact = evaluate(degenerate);
+				double const metal = Coaxial::attenuationCoefficientInMetal(point.frequency, point.sigma, point.epsilon, point.d, point.D);
+				assert(exact.metalAttenuation.contains(metal) && exact.metalAttenuation.width() <= 1e-14 * metal);
+				assert(exact.waveResistance.contains(Coaxial::waveResistance(point.epsilon, point.d, point.D)));
+
+				//   D/d -> 1 (log(D/d)  )    long double:
+				//D - d  , log1p  ,     ,  long double   double (MSVC)
+				for (int i = 0; i < 2000; ++i) {
+					double const d = 1e-3;
+					double const D = d * (1.0 + 1e-5 * std::pow(2000.0, i / 1999.0));
+					Box const thin{ { d, d }, { D, D }, { point.frequency, point.frequency }, { point.sigma, point.sigma },
+						{ point.epsilon, point.epsilon }, { point.Ep, point.Ep }, { point.tanDelta, point.tanDelta } };
+					Bounds const value = evaluate(thin);
+					long double const logarithm = std::log1p((static_cast<long double>(D) - d) / d);
+					long double const root = std::sqrt(static_cast<long double>(point.epsilon));
+					long double const impedance = 60.0L * logarithm / root;
+					long double const voltage = static_cast<long double>(point.Ep) * D / 2.0L * logarithm;
+					long double const power = voltage * voltage / 120.0L * std::sqrt(point.epsilon / logarithm);
+					long double const pi = static_cast<long double>(M_PI);
+					long double const metal = root * std::sqrt(pi * point.frequency * static_cast<long double>(magneticConstant) / point.sigma) *
+						static_cast<long double>(8.68) / (120.0L * pi) * (1.0L / d + 1.0L / D) / logarithm;
+					assert(value.waveResistance.lower <= impedance && impedance <= value.waveResistance.upper);
+					assert(value.peakVoltage.lower <= voltage && voltage <= value.peakVoltage.upper);
+					assert(value.peakPower.lower <= power && power <= value.peakPower.upper);
+					assert(value.metalAttenuation.lower <= metal && metal <= value.metalAttenuation.upper);
+					// -    eps / log(D/d)  
+					assert(value.waveResistance.width() * logarithm <= 1e-14 * impedance);
+				}
+
+				// :      
+				Box const boxes[] = { box, { around(3e-3, 1e-3), around(4e-3, 1e-3), box.frequency, box.sigma, box.epsilon, box.Ep, box.tanDelta } };
+				Bounds results[2];
+				errorMask masks[2];
+				std::size_t const invalid = evaluate(span<Box const>(boxes), span<Bounds>(results), span<errorMask>(masks));
+				assert(invalid == 1 && masks[0] == 0 && masks[1] == errorBit(error::diameters));
+				assert(results[0].peakPower.lower == bounds.peakPower.lower && results[1].waveResistance.lower != results[1].waveResistance.lower);
+
+				// 
+				Box inverted = box;
+				inverted.epsilon = { 2.1, 2.0 };
+				assert(violations(inverted) == errorBit(error::bounds));
+			}
+		} test_Interval;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
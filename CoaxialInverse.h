@@ -0,0 +1,308 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialSpan.h"
+
+// :      (  ,  )
+// :  Z0 = 60 / sqrt(epsilon) * ln(D/d)          =>  D/d = exp(Z0 * sqrt(epsilon) / 60)
+// :      U = Ep * d / 2 * x * ln(x), x = D/d         =>  ln(x) = W(2U / (Ep * d))
+// :        P = (Ep * d / 2)^2 * sqrt(epsilon) / 120 * x^2 * ln(x)^(3/2)
+//                                                                      =>  ln(x) = 3/4 * W(4/3 * q^(2/3)), q = 120P / ((Ep * d / 2)^2 * sqrt(epsilon))
+//W -     (W(z) * exp(W(z)) = z).       D  D > d,
+//  D -   ,   .
+//W          (  2 ULP  z  1e-12  1e300),
+//   -  ,  .
+// D/d -> 1     (  D  1 / ln(D/d)),    D
+//      .
+
+namespace Coaxial {
+	namespace inverse {
+		//    W(z)  z >= 0
+		//z - 
+		template<typename Real>
+		Real lambertW(Real const z) noexcept {
+			using std::exp;
+			using std::log;
+			// : log(1 + z)  ,  L1 - L2 + L2 / L1   z
+			//(    z >= 3:   ,  log(log(z))   NaN  z < 1)
+			Real const L1 = log(z < Real(3) ? Real(3) : z);
+			Real const L2 = log(L1);
+			Real w = z < Real(3) ? Real(0.8) * log(Real(1) + z) : L1 - L2 + L2 / L1;
+			for (int iteration = 0; iteration < 3; ++iteration) {
+				Real const e = exp(w);
+				Real const f = w * e - z;
+				w -= f / (e * (w + Real(1)) - (w + Real(2)) * f / (Real(2) * w + Real(2)));
+			}
+			return w;
+		}
+
+		// D/d        
+		//impedance -  , 
+		//epsilon -   
+		template<typename Real>
+		Real ratioForImpedanceUnchecked(Real const impedance, Real const epsilon) noexcept {
+			using std::exp;
+			using std::sqrt;
+			return exp(impedance * sqrt(epsilon) / Real(60));
+		}
+
+		// D   d        
+		//voltage -  , 
+		//Ep -  , /
+		//d -    , 
+		template<typename Real>
+		Real outerDiameterForVoltageUnchecked(Real const voltage, Real const Ep, Real const d) noexcept {
+			using std::exp;
+			return d * exp(lambertW(Real(2) * voltage / (Ep * d)));
+		}
+
+		// D   d        
+		//power -  , 
+		//epsilon -   
+		//Ep -  , /
+		//d -    , 
+		template<typename Real>
+		Real outerDiameterForPowerUnchecked(Real const power, Real const epsilon, Real const Ep, Real const d) noexcept {
+			using std::cbrt;
+			using std::exp;
+			using std::sqrt;
+			Real const half = Ep * d / Real(2);
+			Real const q = Real(120) * power / (half * half * sqrt(epsilon));
+			//q^(2/3)
+			Real const root = cbrt(q);
+			return d * exp(Real(0.75) * lambertW(Real(4) / Real(3) * root * root));
+		}
+
+		// D/d    
+		//impedance -  , 
+		//epsilon -   
+		double ratioForImpedance(double const impedance, double const epsilon) {
+			if (impedance <= 0.0)
+				throw exception(error::impedance);
+			if (epsilon < 1.0)
+				throw exception(error::epsilon);
+
+			return ratioForImpedanceUnchecked(impedance, epsilon);
+		}
+
+		//        d
+		//impedance -  , 
+		//epsilon -   
+		//d -    , 
+		double outerDiameterForImpedance(double const impedance, double const epsilon, double const d) {
+			if (d <= 0.0)
+				throw exception(error::innerDiameter);
+
+			return d * ratioForImpedance(impedance, epsilon);
+		}
+
+		//        D
+		//impedance -  , 
+		//epsilon -   
+		//D -   , 
+		double innerDiameterForImpedance(double const impedance, double const epsilon, double const D) {
+			if (D <= 0.0)
+				throw exception(error::outerDiameter);
+
+			return D / ratioForImpedance(impedance, epsilon);
+		}
+
+		//     d,    
+		//voltage -  , 
+		//Ep -  , /
+		//d -    , 
+		double outerDiameterForVoltage(double const voltage, double const Ep, double const d) {
+			if (voltage <= 0.0)
+				throw exception(error::voltage);
+			if (Ep <= 0.0)
+				throw exception(error::electricStrength);
+			if (d <= 0.0)
+				throw exception(error::innerDiameter);
+
+			return outerDiameterForVoltageUnchecked(voltage, Ep, d);
+		}
+
+		//     d,    
+		//power -  , 
+		//epsilon -   
+		//Ep -  , /
+		//d -    , 
+		double outerDiameterForPower(double const power, double const epsilon, double const Ep, double const d) {
+			if (power <= 0.0)
+				throw exception(error::power);
+			if (epsilon < 1.0)
+				throw exception(error::epsilon);
+			if (Ep <= 0.0)
+				throw exception(error::electricStrength);
+			if (d <= 0.0)
+				throw exception(error::innerDiameter);
+
+			return outerDiameterForPowerUnchecked(power, epsilon, Ep, d);
+		}
+
+		// :     ,     
+		namespace detail {
+			//  
+			//n -  
+			//length -  
+			void checkLength(std::size_t const n, std::size_t const length) {
+				if (length != n)
+					throw exception(L"     ");
+			}
+
+			//      
+			//mask -    
+			void throwIfInvalid(errorMask const mask) {
+				if (mask != 0)
+					throw exception(firstError(mask));
+			}
+		}
+
+		// D/d    
+		//impedance -   , 
+		//epsilon -   
+		//ratio -  
+		template<typename Real>
+		void ratioForImpedance(span<Real const> const impedance, span<Real const> const epsilon, span<Real> const ratio) {
+			std::size_t const n = impedance.size();
+			detail::checkLength(n, epsilon.size());
+			detail::checkLength(n, ratio.size());
+			errorMask mask = 0;
+			for (std::size_t i = 0; i < n; ++i)
+				mask |= (errorMask(impedance[i] <= Real(0)) * errorBit(error::impedance)) |
+					(errorMask(epsilon[i] < Real(1)) * errorBit(error::epsilon));
+			detail::throwIfInvalid(mask);
+
+			Real const* __restrict z = impedance.data();
+			Real const* __restrict e = epsilon.data();
+			Real* __restrict out = ratio.data();
+			for (std::size_t i = 0; i < n; ++i)
+				out[i] = ratioForImpedanceUnchecked(z[i], e[i]);
+		}
+
+		//      
+		//voltage -   , 
+		//Ep -   , /
+		//d -    , 
+		//D -  , 
+		template<typename Real>
+		void outerDiameterForVoltage(span<Real const> const voltage, span<Real const> const Ep, span<Real const> const d, span<Real> const D) {
+			std::size_t const n = voltage.size();
+			detail::checkLength(n, Ep.size());
+			detail::checkLength(n, d.size());
+			detail::checkLength(n, D.size());
+			errorMask mask = 0;
+			for (std::size_t i = 0; i < n; ++i)
+				mask |= (errorMask(voltage[i] <= Real(0)) * errorBit(error::voltage)) |
+					(errorMask(Ep[i] <= Real(0)) * errorBit(error::electricStrength)) |
+					(errorMask(d[i] <= Real(0)) * errorBit(error::innerDiameter));
+			detail::throwIfInvalid(mask);
+
+			Real const* __restrict u = voltage.data();
+			Real const* __restrict strength = Ep.data();
+			Real const* __restrict inner = d.data();
+			Real* __restrict out = D.data();
+			for (std::size_t i = 0; i < n; ++i)
+				out[i] = outerDiameterForVoltageUnchecked(u[i], strength[i], inner[i]);
+		}
+
+		//      
+		//power -   , 
+		//epsilon -   
+		//Ep -   , /
+		//d -    , 
+		//D -  , 
+		template<typename Real>
+		void outerDiameterForPower(span<Real const> const power, span<Real const> const epsilon, span<Real const> const Ep,
+			span<Real const> const d, span<Real> const D) {
+			std::size_t const n = power.size();
+			detail::checkLength(n, epsilon.size());
+			detail::checkLength(n, Ep.size());
+			detail::checkLength(n, d.size());
+			detail::checkLength(n, D.size());
+			errorMask mask = 0;
+			for (std::size_t i = 0; i < n; ++i)
+				mask |= (errorMask(power[i] <= Real(0)) * errorBit(error::power)) |
+					(errorMask(epsilon[i] < Real(1)) * errorBit(error::epsilon)) |
+					(errorMask(Ep[i] <= Real(0)) * errorBit(error::electricStrength)) |
+					(errorMask(d[i] <= Real(0)) * errorBit(error::innerDiameter));
+			detail::throwIfInvalid(mask);
+
+			Real const* __restrict p = power.data();
+			Real const* __restrict e = epsilon.data();
+			Real const* __restrict strength = Ep.data();
+			Real const* __restrict inner = d.data();
+			Real* __restrict out = D.data();
+			for (std::size_t i = 0; i < n; ++i)
+				out[i] = outerDiameterForPowerUnchecked(p[i], e[i], strength[i], inner[i]);
+		}
+
+#ifdef _DEBUG
+		//  :      
+		class testInverse {
+			//  
+			//value -   
+			//expected -  
+			static void checkClose(double value, double expected) {
+				double const delta = abs(value - expected);
+				assert(delta <= 1e-12 * abs(expected));
+			}
+		public:
+			testInverse() {
+				test();
+			}
+
+			static void test() {
+				//  ( w * exp(w) - z   w -  exp,    1 + w)
+				for (double z = 1e-12; z < 1e300; z *= 1.7) {
+					double const w = lambertW(z);
+					assert(abs(w * exp(w) - z) <= 1e-15 * (1.0 + w) * (1.0 + w) * z);
+				}
+				assert(lambertW(0.0) == 0.0);
+
+				double const epsilon[] = { 1.0, 2.08, 2.25 };
+				double const impedance[] = { 50.0, 75.0, 93.0 };
+				double const Ep[] = { 3e6, 2.5e7, 6e7 };
+				double const d[] = { 0.5e-3, 1e-3, 2.1e-3 };
+				double const voltage[] = { 1e3, 5e4, 3e4 };
+				double const power[] = { 1e5, 2.5e6, 1e5 };
+				double ratio[3], DVoltage[3], DPower[3];
+				ratioForImpedance(span<double const>(impedance), span<double const>(epsilon), span<double>(ratio));
+				outerDiameterForVoltage(span<double const>(voltage), span<double const>(Ep), span<double const>(d), span<double>(DVoltage));
+				outerDiameterForPower(span<double const>(power), span<double const>(epsilon), span<double const>(Ep), span<double const>(d), span<double>(DPower));
+
+				for (std::size_t i = 0; i < 3; ++i) {
+					checkClose(ratio[i], ratioForImpedance(impedance[i], epsilon[i]));
+					checkClose(waveResistance(epsilon[i], d[i], outerDiameterForImpedance(impedance[i], epsilon[i], d[i])), impedance[i]);
+					checkClose(waveResistance(epsilon[i], innerDiameterForImpedance(impedance[i], epsilon[i], 7.3e-3), 7.3e-3), impedance[i]);
+					checkClose(peakVoltage(Ep[i], d[i], DVoltage[i]), voltage[i]);
+					checkClose(peakPower(epsilon[i], Ep[i], d[i], DPower[i]), power[i]);
+					// :   D    
+					assert(peakVoltage(Ep[i], d[i], DVoltage[i] * (1.0 - 1e-9)) < voltage[i]);
+					assert(peakPower(epsilon[i], Ep[i], d[i], DPower[i] * (1.0 - 1e-9)) < power[i]);
+				}
+
+				//  
+				double const badPower[] = { 1e5, 0.0, 10.0 };
+				bool thrown = false;
+				try {
+					outerDiameterForPower(span<double const>(badPower), span<double const>(epsilon), span<double const>(Ep), span<double const>(d), span<double>(DPower));
+				}
+				catch (exception const& e) {
+					thrown = e.code() == error::power;
+				}
+				assert(thrown);
+
+				//  
+				thrown = false;
+				try {
+					innerDiameterForImpedance(50.0, 2.08, 0.0);
+				}
+				catch (exception const& e) {
+					thrown = e.code() == error::outerDiameter;
+				}
+				assert(thrown);
+			}
+		} test_Inverse;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
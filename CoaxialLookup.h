@@ -0,0 +1,200 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialBatch.h"
+#include "CoaxialConstexpr.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+//     
+//   x = m * 2^k, m  [sqrt(1/2), sqrt(2)),    (  fast::log), 
+//log(x) = k * ln2 + (m - 1) * g(m),  g(m) = log(m) / (m - 1) -      m = 1
+//(g(1) = 1); g     256  ,   -   .
+//      (log(D/d), log(d), log(f)   ),  
+//   D/d -> 1,    log(m)    .
+// : |g''''| <= 4! / 5 / (1/2)^(5/2) < 27.2  [sqrt(1/2), sqrt(2)),  w = (sqrt(2) - sqrt(1/2)) / 256,
+//       w^4 / (4! * 2^7) * 27.2 < 5.2e-13  (g >= 0.83,  
+//  6.3e-13 );   -   log   1e-12.
+// - 256 * 4  double (8 ,   L1),   (   ).
+// 1/log(r)  :  evaluate  batch   log(D/d)      .
+//    -  : batch::computeUnchecked<lookup::math>(in, out)  lookup::compute(in, out).
+//  libm, simd::detail::log  fast::log  4096  D/d  1.1-10 -  benchmarks.cpp ( CoaxialBenchmarks).
+//     gather: GCC  -mtune=generic    ( 
+//),       gather (-mtune=skylake, icelake-server, znver4  -march=native   ).
+// fast::log (1e-7)   .
+
+namespace Coaxial {
+	namespace lookup {
+		//  
+		constexpr int intervals = 256;
+		//  
+		constexpr double first = 0.70710678118654752440;
+		constexpr double last = 1.41421356237309504880;
+
+		//   g(first + (i + t) * w) = c0 + t * (c1 + t * (c2 + t * c3)), t  [0, 1)
+		//   compileTime::log:  -  ,   ,
+		//       ,      (gather)
+		struct logTable {
+			// 
+			alignas(64) double c0[intervals]{}, c1[intervals]{}, c2[intervals]{}, c3[intervals]{};
+
+			constexpr logTable() noexcept {
+				//  (1 - cos((2j + 1) * pi / 8)) / 2  [0, 1]
+				constexpr double nodes[4] = { 0.03806023374435663, 0.30865828381745514, 0.69134171618254486, 0.96193976625564337 };
+				double const width = (last - first) / intervals;
+				for (int i = 0; i < intervals; ++i) {
+					// g    (m - 1  , log(m) -     1 ULP)
+					double differences[4]{};
+					for (int j = 0; j < 4; ++j) {
+						double const m = first + (i + nodes[j]) * width;
+						differences[j] = m == 1.0 ? 1.0 : compileTime::log(m) / (m - 1.0);
+					}
+					//  ( ),     t
+					for (int order = 1; order < 4; ++order)
+						for (int j = 3; j >= order; --j)
+							differences[j] = (differences[j] - differences[j - 1]) / (nodes[j] - nodes[j - order]);
+					double power[4] = { differences[3], 0.0, 0.0, 0.0 };
+					for (int j = 2; j >= 0; --j) {
+						//power = power * (t - nodes[j]) + differences[j]
+						for (int n = 3; n > 0; --n)
+							power[n] = power[n - 1] - nodes[j] * power[n];
+						power[0] = differences[j] - nodes[j] * power[0];
+					}
+					c0[i] = power[0];
+					c1[i] = power[1];
+					c2[i] = power[2];
+					c3[i] = power[3];
+				}
+			}
+		};
+
+		//  (  )
+		constexpr logTable logCoefficients{};
+
+		//       1e-12
+		//x -  (,  0,  )
+		double log(double const x) noexcept {
+			constexpr double ln2 = 0.693147180559945309417;
+			constexpr double scale = intervals / (last - first);
+
+			//  -   fast::log
+			std::uint64_t bits;
+			std::memcpy(&bits, &x, sizeof bits);
+			constexpr std::uint64_t sqrtHalfBits = 0x3FE6A09E667F3BCDull;
+			bits += 0x3FF0000000000000ull - sqrtHalfBits;
+			std::uint64_t const exponentBits = (bits >> 52) | 0x4330000000000000ull;
+			double exponent;
+			std::memcpy(&exponent, &exponentBits, sizeof exponent);
+			exponent -= 4503599627370496.0 + 1023.0;
+			bits = (bits & 0x000FFFFFFFFFFFFFull) + sqrtHalfBits;
+			double m;
+			std::memcpy(&m, &bits, sizeof m);
+
+			//  (int32 -    AVX2)    
+			double const u = (m - first) * scale;
+			std::int32_t index = static_cast<std::int32_t>(u);
+			index = index < intervals - 1 ? index : intervals - 1;
+			double const t = u - index;
+			double const g = logCoefficients.c0[index] + t * (logCoefficients.c1[index] +
+				t * (logCoefficients.c2[index] + t * logCoefficients.c3[index]));
+			return exponent * ln2 + (m - 1.0) * g;
+		}
+
+		//     ( )
+		//x - 
+		float log(float const x) noexcept {
+			return static_cast<float>(lookup::log(static_cast<double>(x)));
+		}
+
+		//     ( :   1e-12    )
+		//x - 
+		long double log(long double const x) noexcept {
+			return lookup::log(static_cast<double>(x));
+		}
+
+		//      evaluate  batch::compute
+		struct math {
+			//  ()
+			//x - 
+			template<typename Real>
+			static Real sqrt(Real const x) noexcept {
+				using std::sqrt;
+				return sqrt(x);
+			}
+			//  ()
+			//x - 
+			template<typename Real>
+			static Real log(Real const x) noexcept {
+				return lookup::log(x);
+			}
+		};
+
+		//       (   ,  batch::compute)
+		//in -   
+		//out -  
+		template<typename Real>
+		void compute(batch::basicInputs<Real> const& in, batch::basicOutputs<Real> const& out) {
+			batch::compute<math>(in, out);
+		}
+
+#ifdef _DEBUG
+		//    
+		class testLookup {
+			//  
+			//value -  
+			//exact -  
+			//bound -   
+			static void checkRelative(double value, double exact, double bound) {
+				double const delta = abs(value - exact);
+				assert(delta <= bound * abs(exact));
+			}
+		public:
+			testLookup() {
+				test();
+			}
+
+			static void test() {
+				//  D/d - ,   ,  D/d -> 1    1
+				for (double r = 1.1; r < 10.0; r += 1.3e-5)
+					checkRelative(lookup::log(r), std::log(r), 1e-12);
+				for (double t = 1e-12; t < 1e12; t *= 1.0007)
+					checkRelative(lookup::log(1.0 + t), std::log(1.0 + t), 1e-12);
+				for (double x = 1e-12; x < 1.0; x *= 1.0007)
+					checkRelative(lookup::log(x), std::log(x), 1e-12);
+				//    
+				for (int i = 0; i <= intervals; ++i) {
+					double const m = first + i * ((last - first) / intervals);
+					for (double x : { std::nextafter(m, 0.0), m, std::nextafter(m, 2.0) })
+						checkRelative(lookup::log(x), std::log(x), 1e-12);
+				}
+				//      
+				checkRelative(math::log(3.0f), std::log(3.0), 1e-7);
+				checkRelative(static_cast<double>(math::log(3.0L)), std::log(3.0), 1e-12);
+
+				// :       log,    3/2 ( )
+				double const d[] = { 1e-3, 1e-3, 1e-3, 2.1e-3 };
+				double const D[] = { 1.1e-3, 3.5e-3, 1e-2, 7.3e-3 };
+				double const frequency[] = { 1e9, 1e9, 1e9, 1e10 };
+				double const sigma[] = { 5.8e7, 5.8e7, 5.8e7, 6.1e7 };
+				double const epsilon[] = { 2.1, 2.1, 2.1, 2.08 };
+				double const Ep[] = { 3e7, 3e7, 3e7, 2.5e7 };
+				double const tanDelta[] = { 2e-4, 2e-4, 2e-4, 2.5e-4 };
+				batch::Inputs const in{ d, D, frequency, sigma, epsilon, Ep, tanDelta };
+
+				double wavelength[4], phaseSpeed[4], characteristicResistance[4], dielectricAttenuation[4], metalAttenuation[4],
+					totalAttenuation[4], waveResistance[4], peakVoltage[4], peakPower[4];
+				batch::Outputs const out{ wavelength, phaseSpeed, characteristicResistance, dielectricAttenuation, metalAttenuation,
+					totalAttenuation, waveResistance, peakVoltage, peakPower, {}, {} };
+				lookup::compute(in, out);
+
+				for (std::size_t i = 0; i < 4; ++i) {
+					Results const exact = Coaxial::evaluate(Design{ d[i], D[i], frequency[i], sigma[i], epsilon[i], Ep[i], tanDelta[i] });
+					checkRelative(waveResistance[i], exact.waveResistance, 2e-12);
+					checkRelative(metalAttenuation[i], exact.metalAttenuation, 2e-12);
+					checkRelative(peakPower[i], exact.peakPower, 3e-12);
+				}
+			}
+		} test_Lookup;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
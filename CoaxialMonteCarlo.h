@@ -0,0 +1,717 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialBatch.h"
+#include "CoaxialParallel.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+//   -:          d, D, epsilon, sigma
+//  -   Philox4x32-10:    i  ,    (seed, i),
+//       ,    .
+//      (chunk),         
+//  batch::tryCompute.       ( )      ,
+// -       ( ,  ),
+//   seed           .
+// - O( / chunk +  ),    .
+//   - ,     ,    .
+//         (settings::method):  
+//       -   .      , 
+//   ;   -  ,      .
+//    (measureConvergence)      -  benchmarks.cpp ( CoaxialBenchmarks).
+
+namespace Coaxial {
+	namespace montecarlo {
+		//  Philox4x32-10 (Salmon  ., "Parallel random numbers: as easy as 1, 2, 3", 2011)
+		//   32-   -       
+		struct philox {
+			//  ( )
+			struct block {
+				std::uint32_t word[4];
+			};
+
+			// (seed)
+			std::uint32_t key[2];
+
+			//
+			//seed -   
+			explicit philox(std::uint64_t const seed) noexcept :key{ static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) } {}
+
+			//    
+			//counter - 
+			block operator()(block counter) const noexcept {
+				std::uint32_t k0 = key[0], k1 = key[1];
+				for (int round = 0; round < 10; ++round) {
+					std::uint64_t const product0 = std::uint64_t(0xD2511F53u) * counter.word[0];
+					std::uint64_t const product1 = std::uint64_t(0xCD9E8D57u) * counter.word[2];
+					counter = block{ { static_cast<std::uint32_t>(product1 >> 32) ^ counter.word[1] ^ k0, static_cast<std::uint32_t>(product1),
+						static_cast<std::uint32_t>(product0 >> 32) ^ counter.word[3] ^ k1, static_cast<std::uint32_t>(product0) } };
+					k0 += 0x9E3779B9u;
+					k1 += 0xBB67AE85u;
+				}
+				return counter;
+			}
+
+			//     (0, 1)  53    
+			//random -   
+			//first, second - 
+			static void uniform(block const& random, double& first, double& second) noexcept {
+				double const scale = 1.0 / 9007199254740992.0;
+				first = (double((std::uint64_t(random.word[0]) << 21) ^ (random.word[1] >> 11)) + 0.5) * scale;
+				second = (double((std::uint64_t(random.word[2]) << 21) ^ (random.word[3] >> 11)) + 0.5) * scale;
+			}
+		};
+
+		//  
+		enum class distribution {
+			//   
+			uniform,
+			//,  -   
+			normal
+		};
+
+		//      (0, 1)^4,     
+		enum class sampling {
+			//  (Philox)
+			random,
+			//     
+			sobol,
+			// :     samples  ,      
+			latinHypercube
+		};
+
+		//   (  Joe  Kuo, new-joe-kuo-6.21201)    
+		//   i     (XOR     i),      .
+		// (XOR      )       .
+		class sobol {
+			// : ,  
+			std::uint32_t directions_[4][32];
+			//  
+			std::uint32_t shift_[4];
+		public:
+			//
+			//generator -    
+			explicit sobol(philox const& generator) noexcept {
+				//,         2-4
+				static constexpr unsigned degree[4] = { 0, 1, 2, 3 };
+				static constexpr unsigned coefficients[4] = { 0, 0, 1, 1 };
+				static constexpr std::uint32_t initial[4][3] = { {}, { 1 }, { 1, 3 }, { 1, 3, 1 } };
+				for (unsigned k = 0; k < 32; ++k)
+					directions_[0][k] = std::uint32_t(1) << (31 - k);
+				for (unsigned axis = 1; axis < 4; ++axis) {
+					unsigned const s = degree[axis];
+					std::uint32_t* const v = directions_[axis];
+					for (unsigned k = 0; k < 32; ++k) {
+						if (k < s) {
+							v[k] = initial[axis][k] << (31 - k);
+							continue;
+						}
+						v[k] = v[k - s] ^ (v[k - s] >> s);
+						for (unsigned j = 1; j < s; ++j)
+							v[k] ^= ((coefficients[axis] >> (s - 1 - j)) & 1u) * v[k - j];
+					}
+				}
+				philox::block const random = generator(philox::block{ { 0, 0, 0, 1 } });
+				for (unsigned axis = 0; axis < 4; ++axis)
+					shift_[axis] = random.word[axis];
+			}
+
+			//   (0, 1)^4
+			//index -   ( 2^32)
+			//point - 
+			void operator()(std::uint64_t const index, double (&point)[4]) const noexcept {
+				for (unsigned axis = 0; axis < 4; ++axis) {
+					std::uint32_t x = shift_[axis];
+					for (unsigned k = 0; k < 32; ++k)
+						x ^= directions_[axis][k] & (std::uint32_t(0) - std::uint32_t((index >> k) & 1u));
+					point[axis] = (double(x) + 0.5) * (1.0 / 4294967296.0);
+				}
+			}
+		};
+
+		//    
+		//  i    -    0..samples-1 (- Kensler,
+		//"Correlated Multi-Jittered Sampling", 2013,       ),    - .
+		// - O(1),    i    .
+		class latinHypercube {
+			//   
+			philox generator_;
+			//  ()
+			std::uint32_t count_;
+			//  
+			std::uint32_t keys_[4];
+
+			//  0..count-1
+			//i - 
+			//key -  
+			std::uint32_t permute(std::uint32_t i, std::uint32_t const key) const noexcept {
+				std::uint32_t w = count_ - 1;
+				w |= w >> 1;
+				w |= w >> 2;
+				w |= w >> 4;
+				w |= w >> 8;
+				w |= w >> 16;
+				do {
+					i ^= key; i *= 0xe170893du;
+					i ^= key >> 16; i ^= (i & w) >> 4;
+					i ^= key >> 8; i *= 0x0929eb3fu;
+					i ^= key >> 23; i ^= (i & w) >> 1;
+					i *= 1u | key >> 27; i *= 0x6935fa69u;
+					i ^= (i & w) >> 11; i *= 0x74dcb303u;
+					i ^= (i & w) >> 2; i *= 0x9e501cc3u;
+					i ^= (i & w) >> 2; i *= 0xc860a3dfu;
+					i &= w;
+					i ^= i >> 5;
+				} while (i >= count_);
+				return static_cast<std::uint32_t>((std::uint64_t(i) + key) % count_);
+			}
+		public:
+			//
+			//generator -        
+			//count -   ( 1  2^32 - 1)
+			latinHypercube(philox const& generator, std::uint32_t const count) noexcept :generator_(generator), count_(count) {
+				philox::block const random = generator(philox::block{ { 0, 0, 0, 2 } });
+				for (unsigned axis = 0; axis < 4; ++axis)
+					keys_[axis] = random.word[axis];
+			}
+
+			//  (0, 1)^4
+			//index -   ( count)
+			//point - 
+			void operator()(std::uint64_t const index, double (&point)[4]) const noexcept {
+				philox::block const jitter = generator_(philox::block{ { static_cast<std::uint32_t>(index), 0, 0, 3 } });
+				for (unsigned axis = 0; axis < 4; ++axis)
+					point[axis] = (double(permute(static_cast<std::uint32_t>(index), keys_[axis])) +
+						(double(jitter.word[axis]) + 0.5) * (1.0 / 4294967296.0)) / double(count_);
+			}
+		};
+
+		//     (P. J. Acklam,     1.2e-9)
+		//p -   (0, 1)
+		double inverseNormal(double const p) noexcept {
+			static constexpr double a[] = { -3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+				1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00 };
+			static constexpr double b[] = { -5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+				6.680131188771972e+01, -1.328068155288572e+01 };
+			static constexpr double c[] = { -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+				-2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00 };
+			static constexpr double d[] = { 7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00, 3.754408661907416e+00 };
+			double const low = 0.02425;
+			if (p < low || p > 1.0 - low) {
+				//
+				double const q = std::sqrt(-2.0 * std::log(p < low ? p : 1.0 - p));
+				double const x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+					((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+				return p < low ? x : -x;
+			}
+			double const q = p - 0.5;
+			double const r = q * q;
+			return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+				(((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+		}
+
+		// (   ,   )
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicTolerances {
+			//   , 
+			Real d;
+			//  , 
+			Real D;
+			//  
+			Real epsilon;
+			// , /
+			Real sigma;
+		};
+
+		//    (   )
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicLimits {
+			//  , 
+			Real impedanceMin = Real(0);
+			//  , 
+			Real impedanceMax = std::numeric_limits<Real>::infinity();
+			//  , /
+			Real attenuationMax = std::numeric_limits<Real>::infinity();
+		};
+
+		// 
+		struct settings {
+			// 
+			std::uint64_t samples = 1000000;
+			//  
+			std::uint64_t seed = 0;
+			//  
+			distribution law = distribution::normal;
+			//   ( sobol  latinHypercube -   2^32 - 1 )
+			sampling method = sampling::random;
+			//  (0 -    ),    
+			unsigned threads = 0;
+			//   (    ,      )
+			std::size_t chunk = 4096;
+			//  
+			double accuracy = 1e-3;
+		};
+
+		// : , ,   ,    
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicMoments {
+			std::uint64_t count = 0;
+			Real mean = Real(0);
+			Real m2 = Real(0);
+			Real min = std::numeric_limits<Real>::infinity();
+			Real max = -std::numeric_limits<Real>::infinity();
+
+			//  ( )
+			//x - 
+			void add(Real const x) noexcept {
+				++count;
+				Real const delta = x - mean;
+				mean += delta / static_cast<Real>(count);
+				m2 += delta * (x - mean);
+				min = std::min(min, x);
+				max = std::max(max, x);
+			}
+
+			//    (Chan  .)
+			//other - 
+			void merge(basicMoments const& other) noexcept {
+				if (other.count == 0)
+					return;
+				std::uint64_t const total = count + other.count;
+				Real const delta = other.mean - mean;
+				Real const weight = static_cast<Real>(other.count) / static_cast<Real>(total);
+				mean += delta * weight;
+				m2 += other.m2 + delta * delta * static_cast<Real>(count) * weight;
+				count = total;
+				min = std::min(min, other.min);
+				max = std::max(max, other.max);
+			}
+		};
+
+		//         accuracy
+		// k   (gamma^(k-1), gamma^k], gamma = (1 + accuracy) / (1 - accuracy);
+		//  - 2 * gamma^k / (gamma + 1),          accuracy
+		class sketch {
+			// 
+			double gamma_;
+			//1 / log(gamma)
+			double inverted_;
+			//  counts_[0]
+			int offset_;
+			//   
+			std::vector<std::uint64_t> counts_;
+			//  
+			std::uint64_t total_;
+
+			//    
+			//index -  
+			std::uint64_t& bucket(int const index) {
+				if (counts_.empty())
+					offset_ = index;
+				if (index < offset_) {
+					counts_.insert(counts_.begin(), std::size_t(offset_ - index), 0);
+					offset_ = index;
+				}
+				std::size_t const position = std::size_t(index - offset_);
+				if (position >= counts_.size())
+					counts_.resize(position + 1, 0);
+				return counts_[position];
+			}
+		public:
+			//
+			//accuracy -   
+			explicit sketch(double const accuracy = 1e-3) :gamma_((1.0 + accuracy) / (1.0 - accuracy)), offset_(0), total_(0) {
+				if (!(accuracy > 0.0 && accuracy < 1.0))
+					throw exception(L"     0   1");
+				inverted_ = 1.0 / std::log(gamma_);
+			}
+
+			//  (  )
+			//x - 
+			void add(double const x) {
+				++bucket(static_cast<int>(std::ceil(std::log(x) * inverted_)));
+				++total_;
+			}
+
+			//       
+			//other - 
+			void merge(sketch const& other) {
+				for (std::size_t k = 0; k < other.counts_.size(); ++k)
+					if (other.counts_[k] != 0)
+						bucket(other.offset_ + static_cast<int>(k)) += other.counts_[k];
+				total_ += other.total_;
+			}
+
+			// 
+			std::uint64_t count() const noexcept {
+				return total_;
+			}
+
+			//
+			//q -  (0 - , 0.5 - , 1 -  )
+			double quantile(double const q) const {
+				if (total_ == 0)
+					return std::numeric_limits<double>::quiet_NaN();
+				std::uint64_t const rank = static_cast<std::uint64_t>(std::min(std::max(q, 0.0), 1.0) * double(total_ - 1));
+				std::uint64_t seen = 0;
+				std::size_t k = 0;
+				while (seen + counts_[k] <= rank)
+					seen += counts_[k++];
+				return 2.0 * std::pow(gamma_, double(offset_ + static_cast<int>(k))) / (gamma_ + 1.0);
+			}
+		};
+
+		//  
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicSummary {
+			//
+			basicMoments<Real> moments;
+			//  
+			sketch histogram;
+
+			//
+			Real mean() const noexcept {
+				return moments.mean;
+			}
+			// 
+			Real variance() const noexcept {
+				return moments.count > 1 ? moments.m2 / static_cast<Real>(moments.count - 1) : Real(0);
+			}
+			// 
+			Real standardDeviation() const noexcept {
+				using std::sqrt;
+				return sqrt(variance());
+			}
+			//
+			//q -   0  1
+			Real quantile(double const q) const {
+				return static_cast<Real>(histogram.quantile(q));
+			}
+		};
+
+		//  
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicReport {
+			// 
+			std::uint64_t samples = 0;
+			//     (, D <= d),    
+			std::uint64_t invalid = 0;
+			//,  
+			std::uint64_t passed = 0;
+			// , 
+			basicSummary<Real> waveResistance;
+			// , /
+			basicSummary<Real> totalAttenuation;
+
+			// 
+			double yield() const noexcept {
+				return samples != 0 ? double(passed) / double(samples) : 0.0;
+			}
+		};
+
+		//        seed
+		struct convergence {
+			//    
+			std::uint64_t samples = 0;
+			//  , 
+			double waveResistance = 0.0;
+			//  , /
+			double totalAttenuation = 0.0;
+			// 
+			double yield = 0.0;
+		};
+
+		//  -  
+		using Tolerances = basicTolerances<double>;
+		using Limits = basicLimits<double>;
+		using Moments = basicMoments<double>;
+		using Summary = basicSummary<double>;
+		using Report = basicReport<double>;
+
+		namespace detail {
+			//      
+			class sampler {
+				philox generator_;
+				sampling method_;
+				sobol sobol_;
+				latinHypercube latin_;
+			public:
+				//
+				//options -  
+				explicit sampler(settings const& options) :generator_(options.seed), method_(options.method), sobol_(generator_),
+					latin_(generator_, static_cast<std::uint32_t>(std::min<std::uint64_t>(std::max<std::uint64_t>(options.samples, 1), 0xFFFFFFFFu))) {
+					if (method_ != sampling::random && options.samples > 0xFFFFFFFFu)
+						throw exception(L"        2^32 - 1 ");
+				}
+
+				// :         (uniform)    3 sigma (normal)
+				//  -   ,           
+				//sample -  
+				//law -  
+				//deviations - ,  
+				void operator()(std::uint64_t const sample, distribution const law, double (&deviations)[4]) const noexcept {
+					double u[4];
+					switch (method_) {
+					case sampling::sobol:
+						sobol_(sample, u);
+						break;
+					case sampling::latinHypercube:
+						latin_(sample, u);
+						break;
+					default:
+						for (std::uint32_t half = 0; half < 2; ++half)
+							philox::uniform(generator_(philox::block{ { static_cast<std::uint32_t>(sample), static_cast<std::uint32_t>(sample >> 32), half, 0 } }),
+								u[2 * half], u[2 * half + 1]);
+						break;
+					}
+					for (int k = 0; k < 4; ++k)
+						deviations[k] = law == distribution::uniform ? 2.0 * u[k] - 1.0 : inverseNormal(u[k]) / 3.0;
+				}
+			};
+
+			// :    ,    
+			//Real -      (float, double, long double)
+			template<typename Real>
+			struct partial {
+				sketch waveResistance;
+				sketch totalAttenuation;
+				std::uint64_t invalid = 0;
+				std::uint64_t passed = 0;
+
+				explicit partial(double const accuracy) :waveResistance(accuracy), totalAttenuation(accuracy) {}
+			};
+		}
+
+		//   -
+		//           
+		//Math -    (sqrt, log)
+		//nominal -   
+		//tolerances -  d, D, epsilon, sigma
+		//limits -    
+		//options -  
+		template<typename Math = exactMath, typename Real>
+		basicReport<Real> analyze(basicDesign<Real> const& nominal, basicTolerances<Real> const& tolerances,
+			basicLimits<Real> const& limits = basicLimits<Real>(), settings const& options = settings()) {
+			errorMask const mask = violations(nominal);
+			if (mask != 0)
+				throw exception(firstError(mask));
+			if (tolerances.d < Real(0) || tolerances.D < Real(0) || tolerances.epsilon < Real(0) || tolerances.sigma < Real(0))
+				throw exception(L"    ");
+			if (options.chunk == 0)
+				throw exception(L"     0");
+
+			basicReport<Real> report{ options.samples, 0, 0, { {}, sketch(options.accuracy) }, { {}, sketch(options.accuracy) } };
+			std::uint64_t const chunkCount = (options.samples + options.chunk - 1) / options.chunk;
+			std::vector<basicMoments<Real>> resistanceMoments(static_cast<std::size_t>(chunkCount)), attenuationMoments(static_cast<std::size_t>(chunkCount));
+
+			unsigned const threads = parallel::threadCount(options.threads, chunkCount);
+			std::vector<detail::partial<Real>> partials(threads, detail::partial<Real>(options.accuracy));
+
+			detail::sampler const source(options);
+			std::atomic<std::uint64_t> next(0);
+			auto const worker = [&](detail::partial<Real>& partial) {
+				std::size_t const capacity = options.chunk;
+				std::vector<Real> inputs[7], outputs[9];
+				for (std::vector<Real>& column : inputs)
+					column.resize(capacity);
+				for (std::vector<Real>& column : outputs)
+					column.resize(capacity);
+				std::vector<errorMask> masks(capacity);
+				std::fill(inputs[2].begin(), inputs[2].end(), nominal.frequency);
+				std::fill(inputs[5].begin(), inputs[5].end(), nominal.Ep);
+				std::fill(inputs[6].begin(), inputs[6].end(), nominal.tanDelta);
+
+				for (std::uint64_t chunk = next++; chunk < chunkCount; chunk = next++) {
+					std::uint64_t const begin = chunk * capacity;
+					std::size_t const n = static_cast<std::size_t>(std::min<std::uint64_t>(capacity, options.samples - begin));
+					for (std::size_t row = 0; row < n; ++row) {
+						double deviation[4];
+						source(begin + row, options.law, deviation);
+						inputs[0][row] = nominal.d + tolerances.d * static_cast<Real>(deviation[0]);
+						inputs[1][row] = nominal.D + tolerances.D * static_cast<Real>(deviation[1]);
+						inputs[4][row] = nominal.epsilon + tolerances.epsilon * static_cast<Real>(deviation[2]);
+						inputs[3][row] = nominal.sigma + tolerances.sigma * static_cast<Real>(deviation[3]);
+					}
+					batch::basicInputs<Real> const in{ span<Real const>(inputs[0].data(), n), span<Real const>(inputs[1].data(), n),
+						span<Real const>(inputs[2].data(), n), span<Real const>(inputs[3].data(), n), span<Real const>(inputs[4].data(), n),
+						span<Real const>(inputs[5].data(), n), span<Real const>(inputs[6].data(), n) };
+					batch::basicOutputs<Real> const out{ span<Real>(outputs[0].data(), n), span<Real>(outputs[1].data(), n),
+						span<Real>(outputs[2].data(), n), span<Real>(outputs[3].data(), n), span<Real>(outputs[4].data(), n),
+						span<Real>(outputs[5].data(), n), span<Real>(outputs[6].data(), n), span<Real>(outputs[7].data(), n),
+						span<Real>(outputs[8].data(), n), {}, {} };
+					partial.invalid += batch::tryCompute<Math>(in, out, span<errorMask>(masks.data(), n));
+
+					basicMoments<Real>& resistance = resistanceMoments[static_cast<std::size_t>(chunk)];
+					basicMoments<Real>& attenuation = attenuationMoments[static_cast<std::size_t>(chunk)];
+					for (std::size_t row = 0; row < n; ++row) {
+						if (masks[row] != 0)
+							continue;
+						Real const impedance = out.waveResistance[row];
+						Real const loss = out.totalAttenuation[row];
+						resistance.add(impedance);
+						attenuation.add(loss);
+						partial.waveResistance.add(static_cast<double>(impedance));
+						partial.totalAttenuation.add(static_cast<double>(loss));
+						partial.passed += impedance >= limits.impedanceMin && impedance <= limits.impedanceMax && loss <= limits.attenuationMax;
+					}
+				}
+			};
+
+			parallel::run(threads, [&](unsigned const t) {
+				worker(partials[t]);
+			});
+
+			// -    ,    -  (  )
+			for (std::size_t chunk = 0; chunk < resistanceMoments.size(); ++chunk) {
+				report.waveResistance.moments.merge(resistanceMoments[chunk]);
+				report.totalAttenuation.moments.merge(attenuationMoments[chunk]);
+			}
+			for (detail::partial<Real> const& partial : partials) {
+				report.waveResistance.histogram.merge(partial.waveResistance);
+				report.totalAttenuation.histogram.merge(partial.totalAttenuation);
+				report.invalid += partial.invalid;
+				report.passed += partial.passed;
+			}
+			return report;
+		}
+
+		//     
+		//  replicates   seed = options.seed + r    
+		//  ,         
+		//( -      ,  sampling::sobol  2^24 )
+		//Math -    (sqrt, log)
+		//nominal, tolerances, limits -   analyze
+		//options -   
+		//reference -  
+		//replicates -  
+		template<typename Math = exactMath, typename Real>
+		convergence measureConvergence(basicDesign<Real> const& nominal, basicTolerances<Real> const& tolerances, basicLimits<Real> const& limits,
+			settings const& options, basicReport<Real> const& reference, unsigned const replicates) {
+			if (replicates == 0)
+				throw exception(L"     0");
+			convergence errors;
+			errors.samples = options.samples;
+			for (unsigned r = 0; r < replicates; ++r) {
+				settings replicate = options;
+				replicate.seed = options.seed + r;
+				basicReport<Real> const report = analyze<Math>(nominal, tolerances, limits, replicate);
+				double const resistance = double(report.waveResistance.mean() - reference.waveResistance.mean());
+				double const attenuation = double(report.totalAttenuation.mean() - reference.totalAttenuation.mean());
+				double const yield = report.yield() - reference.yield();
+				errors.waveResistance += resistance * resistance;
+				errors.totalAttenuation += attenuation * attenuation;
+				errors.yield += yield * yield;
+			}
+			errors.waveResistance = std::sqrt(errors.waveResistance / replicates);
+			errors.totalAttenuation = std::sqrt(errors.totalAttenuation / replicates);
+			errors.yield = std::sqrt(errors.yield / replicates);
+			return errors;
+		}
+
+#ifdef _DEBUG
+		//  :   Philox,    ,  ,  ,
+		//    , 
+		class testMonteCarlo {
+		public:
+			testMonteCarlo() {
+				test();
+			}
+
+			static void test() {
+				//  Random123
+				philox::block const zero = philox(0)(philox::block{ { 0, 0, 0, 0 } });
+				assert(zero.word[0] == 0x6627e8d5u && zero.word[1] == 0xe169c58du && zero.word[2] == 0xbc57ac4cu && zero.word[3] == 0x9b00dbd8u);
+				philox::block const ones = philox(~std::uint64_t(0))(philox::block{ { ~0u, ~0u, ~0u, ~0u } });
+				assert(ones.word[0] == 0x408f276du && ones.word[1] == 0x41c83b0eu && ones.word[2] == 0xa20bc7c6u && ones.word[3] == 0x6d5451fdu);
+
+				Design const nominal{ 2.1e-3, 7.3e-3, 1e9, 5.8e7, 2.08, 2.5e7, 2.5e-4 };
+				Tolerances const tolerances{ 0.02e-3, 0.05e-3, 0.04, 5e6 };
+				Limits limits;
+				limits.impedanceMin = 49.0;
+				limits.impedanceMax = 51.0;
+				settings options;
+				options.samples = 20000;
+				options.seed = 12345;
+				options.chunk = 1000;
+
+				//    - 
+				options.threads = 1;
+				Report const single = analyze(nominal, tolerances, limits, options);
+				options.threads = 3;
+				Report const parallel = analyze(nominal, tolerances, limits, options);
+				assert(single.waveResistance.mean() == parallel.waveResistance.mean());
+				assert(single.waveResistance.variance() == parallel.waveResistance.variance());
+				assert(single.totalAttenuation.mean() == parallel.totalAttenuation.mean());
+				assert(single.totalAttenuation.quantile(0.99) == parallel.totalAttenuation.quantile(0.99));
+				assert(single.passed == parallel.passed && single.invalid == 0);
+				assert(single.yield() > 0.0 && single.yield() < 1.0);
+
+				//     ,     
+				double const impedance = Coaxial::waveResistance(nominal.epsilon, nominal.d, nominal.D);
+				assert(abs(single.waveResistance.mean() - impedance) < 0.05);
+				assert(abs(single.waveResistance.quantile(0.5) - impedance) < 0.05 + 2e-3 * impedance);
+				assert(single.waveResistance.moments.min <= single.waveResistance.quantile(0.01));
+				assert(single.waveResistance.quantile(0.99) <= single.waveResistance.moments.max * (1.0 + 2e-3));
+
+				// :  0,  -    
+				options.samples = 100;
+				Report const exact = analyze(nominal, Tolerances{ 0.0, 0.0, 0.0, 0.0 }, Limits(), options);
+				double const attenuation = totalAttenuationCoefficient(nominal.tanDelta, nominal.frequency, nominal.sigma, nominal.epsilon, nominal.d, nominal.D);
+				assert(exact.passed == 100 && exact.totalAttenuation.variance() < 1e-24);
+				assert(abs(exact.totalAttenuation.quantile(0.3) - attenuation) <= 1e-3 * attenuation);
+
+				//    
+				sketch histogram(1e-2);
+				for (int k = 1; k <= 1000; ++k)
+					histogram.add(k);
+				assert(abs(histogram.quantile(0.5) - 500.0) <= 1e-2 * 500.0 + 1.0);
+				assert(abs(histogram.quantile(0.9) - 900.0) <= 1e-2 * 900.0 + 1.0);
+
+				//   
+				assert(abs(inverseNormal(0.975) - 1.959963985) < 1e-8 && abs(inverseNormal(0.001) + 3.090232306) < 1e-8);
+				assert(inverseNormal(0.5) == 0.0);
+
+				//: 64          64  
+				philox const generator(7);
+				sobol const sequence(generator);
+				latinHypercube const latin(generator, 64);
+				bool sobolLayers[4][64] = {}, latinLayers[4][64] = {};
+				for (std::uint64_t i = 0; i < 64; ++i) {
+					double point[4];
+					sequence(i, point);
+					for (int axis = 0; axis < 4; ++axis)
+						sobolLayers[axis][static_cast<int>(point[axis] * 64)] = true;
+					latin(i, point);
+					for (int axis = 0; axis < 4; ++axis)
+						latinLayers[axis][static_cast<int>(point[axis] * 64)] = true;
+				}
+				for (int axis = 0; axis < 4; ++axis)
+					for (int layer = 0; layer < 64; ++layer)
+						assert(sobolLayers[axis][layer] && latinLayers[axis][layer]);
+
+				//:           ,    
+				settings reference;
+				reference.samples = 1 << 15;
+				reference.method = sampling::sobol;
+				Report const exactMean = analyze(nominal, tolerances, limits, reference);
+				settings trial;
+				trial.samples = 512;
+				trial.seed = 100;
+				convergence const random = measureConvergence(nominal, tolerances, limits, trial, exactMean, 6);
+				trial.method = sampling::sobol;
+				convergence const quasi = measureConvergence(nominal, tolerances, limits, trial, exactMean, 6);
+				trial.method = sampling::latinHypercube;
+				convergence const stratified = measureConvergence(nominal, tolerances, limits, trial, exactMean, 6);
+				assert(quasi.waveResistance < 0.3 * random.waveResistance && stratified.waveResistance < 0.3 * random.waveResistance);
+				assert(quasi.totalAttenuation < 0.3 * random.totalAttenuation && stratified.totalAttenuation < 0.3 * random.totalAttenuation);
+			}
+		} test_MonteCarlo;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
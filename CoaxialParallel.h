@@ -0,0 +1,128 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//     (,  , -, , Touchstone,  )
+//     .     (join),     
+//      ;      .
+
+namespace Coaxial {
+	namespace parallel {
+		//   
+		//threads -   (0 -    )
+		//count -   (  ,  ,    1)
+		unsigned threadCount(unsigned const threads, std::uint64_t const count) noexcept {
+			std::uint64_t const requested = threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+			return static_cast<unsigned>(std::max<std::uint64_t>(1, std::min(requested, count)));
+		}
+
+		namespace detail {
+			//        (    )
+			class joiner final {
+				// 
+				std::vector<std::thread>& pool_;
+			public:
+				explicit joiner(std::vector<std::thread>& pool) noexcept :pool_(pool) {}
+				joiner(joiner const&) = delete;
+				joiner& operator=(joiner const&) = delete;
+				~joiner() {
+					for (std::thread& thread : pool_)
+						if (thread.joinable())
+							thread.join();
+				}
+			};
+		}
+
+		// body(t)  t = 0..threads-1,  -    (t = 0 -  )
+		//threads -   ( 0)
+		//body -  
+		template<typename Body>
+		void run(unsigned const threads, Body const& body) {
+			std::exception_ptr failure;
+			std::mutex failureLock;
+			auto const guarded = [&](unsigned const t) noexcept {
+				try {
+					body(t);
+				}
+				catch (...) {
+					std::lock_guard<std::mutex> const hold(failureLock);
+					if (!failure)
+						failure = std::current_exception();
+				}
+			};
+
+			std::vector<std::thread> pool;
+			{
+				detail::joiner const join(pool);
+				pool.reserve(threads - 1);
+				for (unsigned t = 1; t < threads; ++t)
+					pool.emplace_back(guarded, t);
+				guarded(0);
+			}
+			if (failure)
+				std::rethrow_exception(failure);
+		}
+
+		// body(i)  i = 0..count-1,     
+		//count -  
+		//threads -   (0 -    )
+		//body - 
+		template<typename Body>
+		void forEach(std::size_t const count, unsigned const threads, Body const& body) {
+			std::atomic<std::size_t> next(0);
+			run(threadCount(threads, count), [&](unsigned) {
+				for (std::size_t i = next++; i < count; i = next++)
+					body(i);
+			});
+		}
+
+#ifdef _DEBUG
+		//  :      ,     
+		class testParallel {
+		public:
+			testParallel() {
+				test();
+			}
+
+			static void test() {
+				assert(threadCount(0, 1) == 1 && threadCount(8, 3) == 3 && threadCount(2, 100) == 2 && threadCount(4, 0) == 1);
+
+				//     ,    
+				std::vector<int> done(1000, 0);
+				forEach(done.size(), 4, [&](std::size_t const i) {
+					++done[i];
+				});
+				assert(std::count(done.begin(), done.end(), 1) == 1000);
+
+				std::atomic<unsigned> started(0);
+				run(3, [&](unsigned const t) {
+					started += 1u << t;
+				});
+				assert(started == 7);
+
+				//  :   ,   
+				std::atomic<int> finished(0);
+				bool thrown = false;
+				try {
+					forEach(64, 4, [&](std::size_t const i) {
+						if (i == 17)
+							throw std::runtime_error("task 17");
+						++finished;
+					});
+				}
+				catch (std::runtime_error const&) {
+					thrown = true;
+				}
+				assert(thrown && finished == 63);
+			}
+		} test_Parallel;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
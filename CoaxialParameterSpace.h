@@ -0,0 +1,328 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialBatch.h"
+#include <algorithm>
+#include <vector>
+
+//       ( )
+//    ( d, D, f, sigma, epsilon, Ep, tanDelta);    k -  
+//      (d -  , tanDelta - ).
+//     :        
+//    batch::tryCompute,   - O( )    .
+//      (split) -      .
+//  (, D <= d)  ,     NaN,   batch::tryCompute,
+//        .
+
+namespace Coaxial {
+	namespace space {
+		//  
+		constexpr std::size_t axisCount = 7;
+
+		// :    
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicAxes {
+			//   , 
+			span<Real const> d;
+			//  , 
+			span<Real const> D;
+			//  , 
+			span<Real const> frequency;
+			// , /
+			span<Real const> sigma;
+			//  
+			span<Real const> epsilon;
+			// , /
+			span<Real const> Ep;
+			//    
+			span<Real const> tanDelta;
+		};
+
+		//   [first, last)
+		struct range {
+			//  
+			std::uint64_t first;
+			// ,   
+			std::uint64_t last;
+		};
+
+		//     (  )
+		//Real -      (float, double, long double)
+		template<typename Real>
+		class basicBlock {
+			//     
+			std::vector<Real> inputs_[axisCount];
+			//     batch::basicOutputs
+			std::vector<Real> outputs_[9];
+			//  
+			std::vector<errorMask> masks_;
+			//   
+			std::uint64_t first_;
+			//  
+			std::size_t size_;
+
+			template<typename> friend class basicCursor;
+		public:
+			//
+			//capacity -   ( )
+			explicit basicBlock(std::size_t const capacity) :masks_(capacity), first_(0), size_(0) {
+				if (capacity == 0)
+					throw exception(L"     0");
+				for (std::vector<Real>& column : inputs_)
+					column.resize(capacity);
+				for (std::vector<Real>& column : outputs_)
+					column.resize(capacity);
+			}
+
+			// 
+			std::size_t capacity()const noexcept {
+				return masks_.size();
+			}
+			//  
+			std::size_t size()const noexcept {
+				return size_;
+			}
+			//     
+			std::uint64_t first()const noexcept {
+				return first_;
+			}
+
+			//     
+			batch::basicInputs<Real> inputs()const noexcept {
+				return { column(inputs_[0]), column(inputs_[1]), column(inputs_[2]), column(inputs_[3]),
+					column(inputs_[4]), column(inputs_[5]), column(inputs_[6]) };
+			}
+			//    
+			batch::basicOutputs<Real> outputs() noexcept {
+				return { column(outputs_[0]), column(outputs_[1]), column(outputs_[2]), column(outputs_[3]), column(outputs_[4]),
+					column(outputs_[5]), column(outputs_[6]), column(outputs_[7]), column(outputs_[8]), {}, {} };
+			}
+			//     
+			span<errorMask> masks() noexcept {
+				return span<errorMask>(masks_.data(), size_);
+			}
+		private:
+			//  
+			//values - 
+			template<typename T>
+			span<T> column(std::vector<T>& values)const noexcept {
+				return span<T>(values.data(), size_);
+			}
+			template<typename T>
+			span<T const> column(std::vector<T> const& values)const noexcept {
+				return span<T const>(values.data(), size_);
+			}
+		};
+
+		//   -   
+		//Real -      (float, double, long double)
+		template<typename Real>
+		class basicParameterSpace {
+			// 
+			span<Real const> axes_[axisCount];
+			// 
+			std::uint64_t size_;
+		public:
+			//
+			//axes -   (     ,   )
+			explicit basicParameterSpace(basicAxes<Real> const& axes)
+				:axes_{ axes.d, axes.D, axes.frequency, axes.sigma, axes.epsilon, axes.Ep, axes.tanDelta }, size_(1) {
+				for (span<Real const> const& axis : axes_) {
+					if (axis.size() != 0 && size_ > std::numeric_limits<std::uint64_t>::max() / axis.size())
+						throw exception(L"    2^64");
+					size_ *= axis.size();
+				}
+			}
+
+			// 
+			std::uint64_t size()const noexcept {
+				return size_;
+			}
+			// 
+			//axis -   (0 - d, ..., 6 - tanDelta)
+			span<Real const> axis(std::size_t const axis)const noexcept {
+				return axes_[axis];
+			}
+
+			//  
+			range all()const noexcept {
+				return { 0, size_ };
+			}
+
+			//    parts  ,        1
+			//parts -   (,   )
+			std::vector<range> split(std::size_t const parts)const {
+				if (parts == 0)
+					throw exception(L"     0");
+				std::vector<range> ranges(parts);
+				std::uint64_t const base = size_ / parts;
+				std::uint64_t const remainder = size_ % parts;
+				std::uint64_t first = 0;
+				for (std::size_t k = 0; k < parts; ++k) {
+					std::uint64_t const length = base + (k < remainder ? 1 : 0);
+					ranges[k] = { first, first + length };
+					first += length;
+				}
+				return ranges;
+			}
+		};
+
+		//   :       
+		//Real -      (float, double, long double)
+		template<typename Real>
+		class basicCursor {
+			//
+			basicParameterSpace<Real> const& space_;
+			//  
+			std::uint64_t next_;
+			// ,   
+			std::uint64_t last_;
+			//    (   )
+			std::size_t digits_[axisCount];
+		public:
+			//
+			//space - 
+			//points -   
+			basicCursor(basicParameterSpace<Real> const& space, range const points)
+				:space_(space), next_(points.first), last_(points.last), digits_{} {
+				if (points.first > points.last || points.last > space.size())
+					throw exception(L"    ");
+				//     -  ,    
+				std::uint64_t index = next_;
+				for (std::size_t a = axisCount; a-- > 0;) {
+					std::uint64_t const size = space_.axis(a).size();
+					if (size == 0)
+						break;
+					digits_[a] = static_cast<std::size_t>(index % size);
+					index /= size;
+				}
+			}
+
+			//  
+			std::uint64_t remaining()const noexcept {
+				return last_ - next_;
+			}
+
+			//    
+			//    (0 -  )
+			//block -  (      )
+			std::size_t next(basicBlock<Real>& block) noexcept {
+				std::uint64_t const left = last_ - next_;
+				std::size_t const count = left < block.capacity() ? static_cast<std::size_t>(left) : block.capacity();
+				block.first_ = next_;
+				block.size_ = count;
+
+				Real* __restrict columns[axisCount];
+				for (std::size_t a = 0; a < axisCount; ++a)
+					columns[a] = block.inputs_[a].data();
+				std::size_t row = 0;
+				while (row < count) {
+					//  (tanDelta)   :      
+					span<Real const> const fastest = space_.axis(axisCount - 1);
+					std::size_t const run = std::min(count - row, fastest.size() - digits_[axisCount - 1]);
+					for (std::size_t a = 0; a + 1 < axisCount; ++a) {
+						Real const value = space_.axis(a)[digits_[a]];
+						for (std::size_t k = 0; k < run; ++k)
+							columns[a][row + k] = value;
+					}
+					for (std::size_t k = 0; k < run; ++k)
+						columns[axisCount - 1][row + k] = fastest[digits_[axisCount - 1] + k];
+					row += run;
+
+					//   
+					digits_[axisCount - 1] += run;
+					for (std::size_t a = axisCount - 1; a > 0 && digits_[a] == space_.axis(a).size(); --a) {
+						digits_[a] = 0;
+						++digits_[a - 1];
+					}
+				}
+				next_ += count;
+				return count;
+			}
+		};
+
+		//  -  
+		using Axes = basicAxes<double>;
+		using Block = basicBlock<double>;
+		using ParameterSpace = basicParameterSpace<double>;
+		using Cursor = basicCursor<double>;
+
+		//         
+		//    consumer(block)  batch::tryCompute: block.inputs(), block.outputs(), block.masks()
+		//Math -    (sqrt, log)
+		//space - 
+		//points -   
+		//capacity -   ( - O(capacity))
+		//consumer -   
+		template<typename Math = exactMath, typename Real, typename Consumer>
+		void evaluate(basicParameterSpace<Real> const& space, range const points, std::size_t const capacity, Consumer&& consumer) {
+			basicBlock<Real> block(capacity);
+			basicCursor<Real> cursor(space, points);
+			while (cursor.next(block) != 0) {
+				batch::tryCompute<Math>(block.inputs(), block.outputs(), block.masks());
+				consumer(block);
+			}
+		}
+
+#ifdef _DEBUG
+		//  :  ,  ,   
+		class testParameterSpace {
+		public:
+			testParameterSpace() {
+				test();
+			}
+
+			static void test() {
+				double const d[] = { 1e-3, 2.1e-3 };
+				double const D[] = { 1.5e-3, 4.86e-3, 7.3e-3 };
+				double const frequency[] = { 1e9, 1e10 };
+				double const sigma[] = { 5.8e7 };
+				double const epsilon[] = { 1.0, 2.08 };
+				double const Ep[] = { 2.5e7 };
+				double const tanDelta[] = { 2.5e-4, 1e-3, 1e-2 };
+				ParameterSpace const space(Axes{ d, D, frequency, sigma, epsilon, Ep, tanDelta });
+				assert(space.size() == 2 * 3 * 2 * 1 * 2 * 1 * 3);
+
+				// ,   5  (      )
+				std::vector<range> const ranges = space.split(3);
+				assert(ranges.front().first == 0 && ranges.back().last == space.size());
+				std::uint64_t expectedIndex = 0;
+				std::size_t invalid = 0;
+				for (range const& points : ranges)
+					evaluate(space, points, 5, [&](Block& block) {
+						batch::Inputs const in = block.inputs();
+						batch::Outputs const out = block.outputs();
+						assert(block.first() == expectedIndex);
+						for (std::size_t row = 0; row < block.size(); ++row, ++expectedIndex) {
+							//    -    
+							std::uint64_t index = expectedIndex;
+							Design design;
+							design.tanDelta = tanDelta[index % 3]; index /= 3;
+							design.Ep = Ep[0];
+							design.epsilon = epsilon[index % 2]; index /= 2;
+							design.sigma = sigma[0];
+							design.frequency = frequency[index % 2]; index /= 2;
+							design.D = D[index % 3]; index /= 3;
+							design.d = d[index];
+							assert(in.d[row] == design.d && in.D[row] == design.D && in.frequency[row] == design.frequency &&
+								in.epsilon[row] == design.epsilon && in.tanDelta[row] == design.tanDelta);
+
+							expected<Results> const tried = tryEvaluate(design);
+							assert(block.masks()[row] == tried.errors);
+							if (!tried) {
+								assert(out.peakPower[row] != out.peakPower[row]);
+								++invalid;
+								continue;
+							}
+							assert(abs(out.totalAttenuation[row] - tried.value.totalAttenuation) <= 1e-12 * tried.value.totalAttenuation);
+							assert(abs(out.peakPower[row] - tried.value.peakPower) <= 1e-12 * tried.value.peakPower);
+						}
+					});
+				assert(expectedIndex == space.size());
+				//D = 1.5   d = 2.1 : 2 * 2 * 3  
+				assert(invalid == 12);
+			}
+		} test_ParameterSpace;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
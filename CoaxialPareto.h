@@ -0,0 +1,356 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialBatch.h"
+#include "CoaxialParallel.h"
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <vector>
+
+//   ( )    :
+//  ,   ,     .
+//  -  d x D x  (  sigma, epsilon, Ep, tanDelta ).
+//   -      (     ""
+//   , O(n log n));           ,
+//      ,    O(n^2) .
+//       ,      batch::tryCompute
+//   ;     ,       .
+//   10^7  (1000 d x 1000 D x 10 )       -  benchmarks.cpp
+//( CoaxialBenchmarks).
+
+namespace Coaxial {
+	namespace pareto {
+		//  (   )
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicMaterial {
+			// , /
+			Real sigma;
+			//  
+			Real epsilon;
+			// , /
+			Real Ep;
+			//    
+			Real tanDelta;
+		};
+
+		// 
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicProblem {
+			//   , 
+			span<Real const> d;
+			//  , 
+			span<Real const> D;
+			//
+			span<basicMaterial<Real> const> materials;
+			// , 
+			Real frequency;
+			//  , 
+			Real impedance;
+			//  :     TE11 ( -      )
+			bool singleMode = false;
+		};
+
+		// 
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicCandidate {
+			//   : (  * d.size() +  d) * D.size() +  D
+			std::uint64_t index;
+			// 
+			basicDesign<Real> design;
+			// , /
+			Real totalAttenuation;
+			// , 
+			Real peakPower;
+			// , 
+			Real waveResistance;
+			//   " ,  ": , -, | - |
+			Real objectives[3];
+		};
+
+		//  a  b (          )
+		//a, b - 
+		template<typename Real>
+		bool dominates(basicCandidate<Real> const& a, basicCandidate<Real> const& b) noexcept {
+			bool better = false;
+			for (int k = 0; k < 3; ++k) {
+				if (a.objectives[k] > b.objectives[k])
+					return false;
+				better |= a.objectives[k] < b.objectives[k];
+			}
+			return better;
+		}
+
+		//   a,  b,    (  )
+		//a, b - 
+		template<typename Real>
+		bool covers(basicCandidate<Real> const& a, basicCandidate<Real> const& b) noexcept {
+			return a.objectives[0] <= b.objectives[0] && a.objectives[1] <= b.objectives[1] && a.objectives[2] <= b.objectives[2];
+		}
+
+		// :   ,   -   
+		//a, b - 
+		template<typename Real>
+		bool precedes(basicCandidate<Real> const& a, basicCandidate<Real> const& b) noexcept {
+			for (int k = 0; k < 3; ++k)
+				if (a.objectives[k] != b.objectives[k])
+					return a.objectives[k] < b.objectives[k];
+			return a.index < b.index;
+		}
+
+		//   (    , O(n log n))
+		//    precedes:        ,
+		//  ,     (, )  ""  
+		//         -      ( ).
+		//          .
+		//candidates -  ()
+		//     precedes
+		template<typename Real>
+		std::vector<basicCandidate<Real>> nonDominated(std::vector<basicCandidate<Real>>& candidates) {
+			std::sort(candidates.begin(), candidates.end(), precedes<Real>);
+			std::vector<basicCandidate<Real>> front;
+			//:   ->   (     )
+			std::map<Real, Real> stairs;
+			for (basicCandidate<Real> const& candidate : candidates) {
+				Real const second = candidate.objectives[1];
+				Real const third = candidate.objectives[2];
+				auto next = stairs.upper_bound(second);
+				if (next != stairs.begin() && std::prev(next)->second <= third)
+					continue;
+				front.push_back(candidate);
+
+				//             
+				while (next != stairs.end() && next->second >= third)
+					next = stairs.erase(next);
+				stairs[second] = third;
+			}
+			return front;
+		}
+
+		//     
+		//    ;         
+		// ,   - O( + ),   - O(n log n)  O(n * ||)  O(n^2).
+		//      (       ).
+		//Real -      (float, double, long double)
+		template<typename Real>
+		class basicArchive {
+			//    precedes
+			std::vector<basicCandidate<Real>> front_;
+			//,    
+			std::vector<basicCandidate<Real>> pending_;
+			// 
+			std::size_t capacity_;
+
+			//  
+			void flush() {
+				if (pending_.empty())
+					return;
+				pending_.insert(pending_.end(), front_.begin(), front_.end());
+				front_ = nonDominated(pending_);
+				pending_.clear();
+			}
+		public:
+			//
+			//capacity -  
+			explicit basicArchive(std::size_t const capacity = 65536) :capacity_(capacity) {
+				if (capacity == 0)
+					throw exception(L"      0");
+				pending_.reserve(capacity);
+			}
+
+			// 
+			//candidate - 
+			void insert(basicCandidate<Real> const& candidate) {
+				pending_.push_back(candidate);
+				if (pending_.size() >= capacity_)
+					flush();
+			}
+
+			//    
+			//other - 
+			void merge(basicArchive& other) {
+				other.flush();
+				pending_.insert(pending_.end(), other.front_.begin(), other.front_.end());
+				flush();
+			}
+
+			//    precedes (  )
+			std::vector<basicCandidate<Real>> const& front() {
+				flush();
+				return front_;
+			}
+		};
+
+		//  -  
+		using Material = basicMaterial<double>;
+		using Problem = basicProblem<double>;
+		using Candidate = basicCandidate<double>;
+		using Archive = basicArchive<double>;
+
+		namespace detail {
+			//       
+			//problem -  
+			//first, last -   [first, last)
+			//capacity -    
+			//archive -  
+			template<typename Math, typename Real>
+			void exploreRange(basicProblem<Real> const& problem, std::uint64_t const first, std::uint64_t const last,
+				std::size_t const capacity, basicArchive<Real>& archive) {
+				using std::abs;
+				std::vector<Real> inputs[7], outputs[9];
+				for (std::vector<Real>& column : inputs)
+					column.resize(capacity);
+				for (std::vector<Real>& column : outputs)
+					column.resize(capacity);
+				std::vector<errorMask> masks(capacity);
+				std::vector<Real> cutoff(problem.singleMode ? capacity : 0);
+				std::vector<std::uint8_t> singleMode(problem.singleMode ? capacity : 0);
+
+				std::uint64_t const columns = problem.D.size();
+				std::uint64_t const perMaterial = problem.d.size() * columns;
+				for (std::uint64_t begin = first; begin < last; begin += capacity) {
+					std::size_t const n = static_cast<std::size_t>(std::min<std::uint64_t>(capacity, last - begin));
+					for (std::size_t row = 0; row < n; ++row) {
+						std::uint64_t const index = begin + row;
+						basicMaterial<Real> const& material = problem.materials[static_cast<std::size_t>(index / perMaterial)];
+						std::uint64_t const cell = index % perMaterial;
+						inputs[0][row] = problem.d[static_cast<std::size_t>(cell / columns)];
+						inputs[1][row] = problem.D[static_cast<std::size_t>(cell % columns)];
+						inputs[2][row] = problem.frequency;
+						inputs[3][row] = material.sigma;
+						inputs[4][row] = material.epsilon;
+						inputs[5][row] = material.Ep;
+						inputs[6][row] = material.tanDelta;
+					}
+					batch::basicInputs<Real> const in{ span<Real const>(inputs[0].data(), n), span<Real const>(inputs[1].data(), n),
+						span<Real const>(inputs[2].data(), n), span<Real const>(inputs[3].data(), n), span<Real const>(inputs[4].data(), n),
+						span<Real const>(inputs[5].data(), n), span<Real const>(inputs[6].data(), n) };
+					batch::basicOutputs<Real> const out{ span<Real>(outputs[0].data(), n), span<Real>(outputs[1].data(), n),
+						span<Real>(outputs[2].data(), n), span<Real>(outputs[3].data(), n), span<Real>(outputs[4].data(), n),
+						span<Real>(outputs[5].data(), n), span<Real>(outputs[6].data(), n), span<Real>(outputs[7].data(), n),
+						span<Real>(outputs[8].data(), n), span<Real>(cutoff.data(), cutoff.empty() ? 0 : n),
+						span<std::uint8_t>(singleMode.data(), singleMode.empty() ? 0 : n) };
+					batch::tryCompute<Math>(in, out, span<errorMask>(masks.data(), n));
+
+					for (std::size_t row = 0; row < n; ++row) {
+						if (masks[row] != 0 || (problem.singleMode && singleMode[row] == 0))
+							continue;
+						basicCandidate<Real> candidate;
+						candidate.index = begin + row;
+						candidate.design = { in.d[row], in.D[row], in.frequency[row], in.sigma[row], in.epsilon[row], in.Ep[row], in.tanDelta[row] };
+						candidate.totalAttenuation = out.totalAttenuation[row];
+						candidate.peakPower = out.peakPower[row];
+						candidate.waveResistance = out.waveResistance[row];
+						candidate.objectives[0] = candidate.totalAttenuation;
+						candidate.objectives[1] = -candidate.peakPower;
+						candidate.objectives[2] = abs(candidate.waveResistance - problem.impedance);
+						archive.insert(candidate);
+					}
+				}
+			}
+		}
+
+		//     
+		//      ( ,  D <= d, )
+		//Math -    (sqrt, log)
+		//problem -  
+		//threads -   (0 -    )
+		//capacity -    
+		template<typename Math = exactMath, typename Real>
+		std::vector<basicCandidate<Real>> explore(basicProblem<Real> const& problem, unsigned threads = 0, std::size_t const capacity = 4096) {
+			if (problem.frequency <= Real(0))
+				throw exception(error::frequency);
+			if (problem.impedance <= Real(0))
+				throw exception(error::impedance);
+			if (capacity == 0)
+				throw exception(L"     0");
+
+			std::uint64_t const total = std::uint64_t(problem.d.size()) * problem.D.size() * problem.materials.size();
+			threads = parallel::threadCount(threads, total / capacity + 1);
+
+			std::vector<basicArchive<Real>> archives(threads);
+			parallel::run(threads, [&](unsigned const t) {
+				detail::exploreRange<Math>(problem, total * t / threads, total * (t + 1) / threads, capacity, archives[t]);
+			});
+
+			for (unsigned t = 1; t < threads; ++t)
+				archives[0].merge(archives[t]);
+			return archives[0].front();
+		}
+
+#ifdef _DEBUG
+		//   :          
+		class testPareto {
+		public:
+			testPareto() {
+				test();
+			}
+
+			static void test() {
+				double d[12], D[15];
+				for (std::size_t i = 0; i < 12; ++i)
+					d[i] = 0.5e-3 + 0.25e-3 * i;
+				for (std::size_t j = 0; j < 15; ++j)
+					D[j] = 1e-3 + 0.6e-3 * j;
+				Material const materials[] = { { 5.8e7, 2.08, 2.5e7, 2.5e-4 }, { 3.5e7, 2.25, 3e7, 4e-4 }, { 5.8e7, 1.0, 3e6, 1e-6 } };
+				Problem const problem{ d, D, materials, 1e9, 50.0 };
+
+				std::vector<Candidate> const single = explore(problem, 1, 7);
+
+				//  :         TE11
+				Problem highFrequency = problem;
+				highFrequency.frequency = 3e10;
+				highFrequency.singleMode = true;
+				std::vector<Candidate> const singleMode = explore(highFrequency, 2, 11);
+				assert(!singleMode.empty());
+				for (Candidate const& candidate : singleMode)
+					assert(candidate.design.frequency < cutoffFrequency(candidate.design.epsilon, candidate.design.d, candidate.design.D));
+				highFrequency.singleMode = false;
+				bool multimode = false;
+				for (Candidate const& candidate : explore(highFrequency, 1, 11))
+					multimode |= candidate.design.frequency >= cutoffFrequency(candidate.design.epsilon, candidate.design.d, candidate.design.D);
+				assert(multimode);
+				std::vector<Candidate> const parallel = explore(problem, 3, 5);
+				assert(!single.empty() && single.size() == parallel.size());
+				for (std::size_t k = 0; k < single.size(); ++k)
+					assert(single[k].index == parallel[k].index);
+
+				//      
+				std::vector<Candidate> all;
+				for (std::size_t m = 0; m < 3; ++m)
+					for (std::size_t i = 0; i < 12; ++i)
+						for (std::size_t j = 0; j < 15; ++j) {
+							Design const design{ d[i], D[j], 1e9, materials[m].sigma, materials[m].epsilon, materials[m].Ep, materials[m].tanDelta };
+							expected<Results> const result = tryEvaluate(design);
+							if (!result)
+								continue;
+							Candidate candidate;
+							candidate.index = (m * 12 + i) * 15 + j;
+							candidate.objectives[0] = result.value.totalAttenuation;
+							candidate.objectives[1] = -result.value.peakPower;
+							candidate.objectives[2] = abs(result.value.waveResistance - 50.0);
+							all.push_back(candidate);
+						}
+				std::size_t nonDominated = 0;
+				for (Candidate const& a : all) {
+					bool dominated = false;
+					for (Candidate const& b : all)
+						dominated |= dominates(b, a);
+					if (dominated)
+						continue;
+					++nonDominated;
+					bool found = false;
+					for (Candidate const& c : single)
+						found |= covers(c, a) && covers(a, c);
+					assert(found);
+				}
+				assert(nonDominated >= single.size());
+				for (std::size_t k = 1; k < single.size(); ++k)
+					assert(single[k - 1].totalAttenuation <= single[k].totalAttenuation);
+			}
+		} test_Pareto;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
@@ -0,0 +1,449 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialSpan.h"
+#include <cstring>
+
+//    ,    log(D/d)  sqrt(epsilon):
+// ,      .
+//: SSE2 (2   ), AVX2 (4), AVX-512F (8)  ;       
+//   (    ).
+//    ( fdlibm:   [sqrt(1/2), sqrt(2))   14-   s = f / (2 + f)),
+// -   sqrt ( ).
+//:
+//-          (0 ULP),         IEEE 754
+//    ;  -      (FMA) : /fp:precise (MSVC)  -ffp-contract=off (GCC/Clang);
+//-    libm log     1 ULP;
+//-    evaluate()  batch::compute()     4 ULP.
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define COAXIAL_SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+//MSVC        /arch
+#define COAXIAL_TARGET(isa)
+#else
+//GCC  Clang        
+#define COAXIAL_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+namespace Coaxial {
+	namespace simd {
+		// ,  
+		enum class isa {
+			//  ( )
+			scalar,
+			//SSE2, 2  double  
+			sse2,
+			//AVX2, 4  double  
+			avx2,
+			//AVX-512F, 8  double  
+			avx512
+		};
+
+		//   (tanDelta     )
+		struct Inputs {
+			//   , 
+			span<double const> d;
+			//  , 
+			span<double const> D;
+			//  , 
+			span<double const> frequency;
+			// , /
+			span<double const> sigma;
+			//  
+			span<double const> epsilon;
+			// , /
+			span<double const> Ep;
+		};
+
+		// 
+		struct Outputs {
+			// , 
+			span<double> waveResistance;
+			//  , /
+			span<double> metalAttenuation;
+			// , 
+			span<double> peakPower;
+		};
+
+		namespace detail {
+			//   (fdlibm e_log.c)
+			constexpr double ln2_hi = 6.93147180369123816490e-01;
+			constexpr double ln2_lo = 1.90821492927058770002e-10;
+			constexpr double Lg1 = 6.666666666666735130e-01;
+			constexpr double Lg2 = 3.999999999940941908e-01;
+			constexpr double Lg3 = 2.857142874366239149e-01;
+			constexpr double Lg4 = 2.222219843214978396e-01;
+			constexpr double Lg5 = 1.818357216161805012e-01;
+			constexpr double Lg6 = 1.531383769920937332e-01;
+			constexpr double Lg7 = 1.479819860511658591e-01;
+			constexpr double sqrt2 = 1.41421356237309514547;
+			//2^52:             double
+			constexpr double two52 = 4503599627370496.0;
+			constexpr std::uint64_t mantissaMask = 0x000FFFFFFFFFFFFFull;
+			constexpr std::uint64_t oneBits = 0x3FF0000000000000ull;
+			constexpr std::uint64_t two52Bits = 0x4330000000000000ull;
+
+			//    
+			//   :       
+			//x -  (,  0,  )
+			double log(double const x) noexcept {
+				std::uint64_t bits;
+				std::memcpy(&bits, &x, sizeof bits);
+				std::uint64_t exponent = bits >> 52;
+				std::uint64_t const mantissaBits = (bits & mantissaMask) | oneBits;
+				double m;
+				std::memcpy(&m, &mantissaBits, sizeof m);
+				//   [sqrt(1/2), sqrt(2))
+				if (m > sqrt2) {
+					m = m * 0.5;
+					exponent += 1;
+				}
+				std::uint64_t const exponentBits = exponent | two52Bits;
+				double biased;
+				std::memcpy(&biased, &exponentBits, sizeof biased);
+				double const k = (biased - two52) - 1023.0;
+
+				double const f = m - 1.0;
+				double const s = f / (2.0 + f);
+				double const z = s * s;
+				double const w = z * z;
+				double const t1 = w * (Lg2 + w * (Lg4 + w * Lg6));
+				double const t2 = z * (Lg1 + w * (Lg3 + w * (Lg5 + w * Lg7)));
+				double const R = t2 + t1;
+				double const hfsq = 0.5 * f * f;
+				return k * ln2_hi - ((hfsq - (s * (hfsq + R) + k * ln2_lo)) - f);
+			}
+
+			//   [begin, end)
+			void kernelScalar(Inputs const& in, Outputs const& out, std::size_t const begin, std::size_t const end) noexcept {
+				for (std::size_t i = begin; i < end; ++i) {
+					double const sqrtEpsilon = sqrt(in.epsilon[i]);
+					double const logRatio = detail::log(in.D[i] / in.d[i]);
+					double const omega = (2.0 * M_PI) * in.frequency[i];
+					double const R_superficial = sqrt((omega * magneticConstant) / (2.0 * in.sigma[i]));
+					double const u = in.Ep[i] * (in.D[i] * 0.5) * logRatio;
+
+					out.waveResistance[i] = (60.0 * logRatio) / sqrtEpsilon;
+					out.metalAttenuation[i] = (sqrtEpsilon * (R_superficial / in.d[i] + R_superficial / in.D[i])) / ((120.0 * M_PI) * logRatio) * 8.68;
+					out.peakPower[i] = ((u * u) / 120.0) * sqrt(in.epsilon[i] / logRatio);
+				}
+			}
+
+#ifdef COAXIAL_SIMD_X86
+			//   (SSE2)
+			COAXIAL_TARGET("sse2")
+			inline __m128d log(__m128d const x) noexcept {
+				__m128i const bits = _mm_castpd_si128(x);
+				__m128i exponent = _mm_srli_epi64(bits, 52);
+				__m128d m = _mm_castsi128_pd(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi64x(static_cast<long long>(mantissaMask))),
+					_mm_set1_epi64x(static_cast<long long>(oneBits))));
+				__m128d const big = _mm_cmpgt_pd(m, _mm_set1_pd(sqrt2));
+				m = _mm_or_pd(_mm_and_pd(big, _mm_mul_pd(m, _mm_set1_pd(0.5))), _mm_andnot_pd(big, m));
+				//  -   (-1),   1  
+				exponent = _mm_sub_epi64(exponent, _mm_castpd_si128(big));
+				__m128d const biased = _mm_castsi128_pd(_mm_or_si128(exponent, _mm_set1_epi64x(static_cast<long long>(two52Bits))));
+				__m128d const k = _mm_sub_pd(_mm_sub_pd(biased, _mm_set1_pd(two52)), _mm_set1_pd(1023.0));
+
+				__m128d const f = _mm_sub_pd(m, _mm_set1_pd(1.0));
+				__m128d const s = _mm_div_pd(f, _mm_add_pd(_mm_set1_pd(2.0), f));
+				__m128d const z = _mm_mul_pd(s, s);
+				__m128d const w = _mm_mul_pd(z, z);
+				__m128d const t1 = _mm_mul_pd(w, _mm_add_pd(_mm_set1_pd(Lg2), _mm_mul_pd(w, _mm_add_pd(_mm_set1_pd(Lg4), _mm_mul_pd(w, _mm_set1_pd(Lg6))))));
+				__m128d const t2 = _mm_mul_pd(z, _mm_add_pd(_mm_set1_pd(Lg1), _mm_mul_pd(w, _mm_add_pd(_mm_set1_pd(Lg3),
+					_mm_mul_pd(w, _mm_add_pd(_mm_set1_pd(Lg5), _mm_mul_pd(w, _mm_set1_pd(Lg7))))))));
+				__m128d const R = _mm_add_pd(t2, t1);
+				__m128d const hfsq = _mm_mul_pd(_mm_mul_pd(_mm_set1_pd(0.5), f), f);
+				__m128d const inner = _mm_add_pd(_mm_mul_pd(s, _mm_add_pd(hfsq, R)), _mm_mul_pd(k, _mm_set1_pd(ln2_lo)));
+				return _mm_sub_pd(_mm_mul_pd(k, _mm_set1_pd(ln2_hi)), _mm_sub_pd(_mm_sub_pd(hfsq, inner), f));
+			}
+
+			//     (SSE2),  - 
+			COAXIAL_TARGET("sse2")
+			void kernelSse2(Inputs const& in, Outputs const& out, std::size_t const n) noexcept {
+				std::size_t i = 0;
+				for (; i + 2 <= n; i += 2) {
+					__m128d const d = _mm_loadu_pd(in.d.data() + i);
+					__m128d const D = _mm_loadu_pd(in.D.data() + i);
+					__m128d const epsilon = _mm_loadu_pd(in.epsilon.data() + i);
+
+					__m128d const sqrtEpsilon = _mm_sqrt_pd(epsilon);
+					__m128d const logRatio = log(_mm_div_pd(D, d));
+					__m128d const omega = _mm_mul_pd(_mm_set1_pd(2.0 * M_PI), _mm_loadu_pd(in.frequency.data() + i));
+					__m128d const R_superficial = _mm_sqrt_pd(_mm_div_pd(_mm_mul_pd(omega, _mm_set1_pd(magneticConstant)),
+						_mm_mul_pd(_mm_set1_pd(2.0), _mm_loadu_pd(in.sigma.data() + i))));
+					__m128d const u = _mm_mul_pd(_mm_mul_pd(_mm_loadu_pd(in.Ep.data() + i), _mm_mul_pd(D, _mm_set1_pd(0.5))), logRatio);
+
+					_mm_storeu_pd(out.waveResistance.data() + i, _mm_div_pd(_mm_mul_pd(_mm_set1_pd(60.0), logRatio), sqrtEpsilon));
+					__m128d const metal = _mm_div_pd(_mm_mul_pd(sqrtEpsilon, _mm_add_pd(_mm_div_pd(R_superficial, d), _mm_div_pd(R_superficial, D))),
+						_mm_mul_pd(_mm_set1_pd(120.0 * M_PI), logRatio));
+					_mm_storeu_pd(out.metalAttenuation.data() + i, _mm_mul_pd(metal, _mm_set1_pd(8.68)));
+					_mm_storeu_pd(out.peakPower.data() + i, _mm_mul_pd(_mm_div_pd(_mm_mul_pd(u, u), _mm_set1_pd(120.0)),
+						_mm_sqrt_pd(_mm_div_pd(epsilon, logRatio))));
+				}
+				kernelScalar(in, out, i, n);
+			}
+
+			//   (AVX2)
+			COAXIAL_TARGET("avx2")
+			inline __m256d log(__m256d const x) noexcept {
+				__m256i const bits = _mm256_castpd_si256(x);
+				__m256i exponent = _mm256_srli_epi64(bits, 52);
+				__m256d m = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(static_cast<long long>(mantissaMask))),
+					_mm256_set1_epi64x(static_cast<long long>(oneBits))));
+				__m256d const big = _mm256_cmp_pd(m, _mm256_set1_pd(sqrt2), _CMP_GT_OQ);
+				m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+				exponent = _mm256_sub_epi64(exponent, _mm256_castpd_si256(big));
+				__m256d const biased = _mm256_castsi256_pd(_mm256_or_si256(exponent, _mm256_set1_epi64x(static_cast<long long>(two52Bits))));
+				__m256d const k = _mm256_sub_pd(_mm256_sub_pd(biased, _mm256_set1_pd(two52)), _mm256_set1_pd(1023.0));
+
+				__m256d const f = _mm256_sub_pd(m, _mm256_set1_pd(1.0));
+				__m256d const s = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f));
+				__m256d const z = _mm256_mul_pd(s, s);
+				__m256d const w = _mm256_mul_pd(z, z);
+				__m256d const t1 = _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(Lg2), _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(Lg4), _mm256_mul_pd(w, _mm256_set1_pd(Lg6))))));
+				__m256d const t2 = _mm256_mul_pd(z, _mm256_add_pd(_mm256_set1_pd(Lg1), _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(Lg3),
+					_mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(Lg5), _mm256_mul_pd(w, _mm256_set1_pd(Lg7))))))));
+				__m256d const R = _mm256_add_pd(t2, t1);
+				__m256d const hfsq = _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(0.5), f), f);
+				__m256d const inner = _mm256_add_pd(_mm256_mul_pd(s, _mm256_add_pd(hfsq, R)), _mm256_mul_pd(k, _mm256_set1_pd(ln2_lo)));
+				return _mm256_sub_pd(_mm256_mul_pd(k, _mm256_set1_pd(ln2_hi)), _mm256_sub_pd(_mm256_sub_pd(hfsq, inner), f));
+			}
+
+			//     (AVX2),  - 
+			COAXIAL_TARGET("avx2")
+			void kernelAvx2(Inputs const& in, Outputs const& out, std::size_t const n) noexcept {
+				std::size_t i = 0;
+				for (; i + 4 <= n; i += 4) {
+					__m256d const d = _mm256_loadu_pd(in.d.data() + i);
+					__m256d const D = _mm256_loadu_pd(in.D.data() + i);
+					__m256d const epsilon = _mm256_loadu_pd(in.epsilon.data() + i);
+
+					__m256d const sqrtEpsilon = _mm256_sqrt_pd(epsilon);
+					__m256d const logRatio = log(_mm256_div_pd(D, d));
+					__m256d const omega = _mm256_mul_pd(_mm256_set1_pd(2.0 * M_PI), _mm256_loadu_pd(in.frequency.data() + i));
+					__m256d const R_superficial = _mm256_sqrt_pd(_mm256_div_pd(_mm256_mul_pd(omega, _mm256_set1_pd(magneticConstant)),
+						_mm256_mul_pd(_mm256_set1_pd(2.0), _mm256_loadu_pd(in.sigma.data() + i))));
+					__m256d const u = _mm256_mul_pd(_mm256_mul_pd(_mm256_loadu_pd(in.Ep.data() + i), _mm256_mul_pd(D, _mm256_set1_pd(0.5))), logRatio);
+
+					_mm256_storeu_pd(out.waveResistance.data() + i, _mm256_div_pd(_mm256_mul_pd(_mm256_set1_pd(60.0), logRatio), sqrtEpsilon));
+					__m256d const metal = _mm256_div_pd(_mm256_mul_pd(sqrtEpsilon, _mm256_add_pd(_mm256_div_pd(R_superficial, d), _mm256_div_pd(R_superficial, D))),
+						_mm256_mul_pd(_mm256_set1_pd(120.0 * M_PI), logRatio));
+					_mm256_storeu_pd(out.metalAttenuation.data() + i, _mm256_mul_pd(metal, _mm256_set1_pd(8.68)));
+					_mm256_storeu_pd(out.peakPower.data() + i, _mm256_mul_pd(_mm256_div_pd(_mm256_mul_pd(u, u), _mm256_set1_pd(120.0)),
+						_mm256_sqrt_pd(_mm256_div_pd(epsilon, logRatio))));
+				}
+				kernelScalar(in, out, i, n);
+			}
+
+			//   (AVX-512F)
+			COAXIAL_TARGET("avx512f")
+			inline __m512d log(__m512d const x) noexcept {
+				__m512i const bits = _mm512_castpd_si512(x);
+				__m512i exponent = _mm512_srli_epi64(bits, 52);
+				__m512d m = _mm512_castsi512_pd(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi64(static_cast<long long>(mantissaMask))),
+					_mm512_set1_epi64(static_cast<long long>(oneBits))));
+				__mmask8 const big = _mm512_cmp_pd_mask(m, _mm512_set1_pd(sqrt2), _CMP_GT_OQ);
+				m = _mm512_mask_mul_pd(m, big, m, _mm512_set1_pd(0.5));
+				exponent = _mm512_mask_add_epi64(exponent, big, exponent, _mm512_set1_epi64(1));
+				__m512d const biased = _mm512_castsi512_pd(_mm512_or_si512(exponent, _mm512_set1_epi64(static_cast<long long>(two52Bits))));
+				__m512d const k = _mm512_sub_pd(_mm512_sub_pd(biased, _mm512_set1_pd(two52)), _mm512_set1_pd(1023.0));
+
+				__m512d const f = _mm512_sub_pd(m, _mm512_set1_pd(1.0));
+				__m512d const s = _mm512_div_pd(f, _mm512_add_pd(_mm512_set1_pd(2.0), f));
+				__m512d const z = _mm512_mul_pd(s, s);
+				__m512d const w = _mm512_mul_pd(z, z);
+				__m512d const t1 = _mm512_mul_pd(w, _mm512_add_pd(_mm512_set1_pd(Lg2), _mm512_mul_pd(w, _mm512_add_pd(_mm512_set1_pd(Lg4), _mm512_mul_pd(w, _mm512_set1_pd(Lg6))))));
+				__m512d const t2 = _mm512_mul_pd(z, _mm512_add_pd(_mm512_set1_pd(Lg1), _mm512_mul_pd(w, _mm512_add_pd(_mm512_set1_pd(Lg3),
+					_mm512_mul_pd(w, _mm512_add_pd(_mm512_set1_pd(Lg5), _mm512_mul_pd(w, _mm512_set1_pd(Lg7))))))));
+				__m512d const R = _mm512_add_pd(t2, t1);
+				__m512d const hfsq = _mm512_mul_pd(_mm512_mul_pd(_mm512_set1_pd(0.5), f), f);
+				__m512d const inner = _mm512_add_pd(_mm512_mul_pd(s, _mm512_add_pd(hfsq, R)), _mm512_mul_pd(k, _mm512_set1_pd(ln2_lo)));
+				return _mm512_sub_pd(_mm512_mul_pd(k, _mm512_set1_pd(ln2_hi)), _mm512_sub_pd(_mm512_sub_pd(hfsq, inner), f));
+			}
+
+			//     (AVX-512F),  - 
+			COAXIAL_TARGET("avx512f")
+			void kernelAvx512(Inputs const& in, Outputs const& out, std::size_t const n) noexcept {
+				std::size_t i = 0;
+				for (; i + 8 <= n; i += 8) {
+					__m512d const d = _mm512_loadu_pd(in.d.data() + i);
+					__m512d const D = _mm512_loadu_pd(in.D.data() + i);
+					__m512d const epsilon = _mm512_loadu_pd(in.epsilon.data() + i);
+
+					__m512d const sqrtEpsilon = _mm512_sqrt_pd(epsilon);
+					__m512d const logRatio = log(_mm512_div_pd(D, d));
+					__m512d const omega = _mm512_mul_pd(_mm512_set1_pd(2.0 * M_PI), _mm512_loadu_pd(in.frequency.data() + i));
+					__m512d const R_superficial = _mm512_sqrt_pd(_mm512_div_pd(_mm512_mul_pd(omega, _mm512_set1_pd(magneticConstant)),
+						_mm512_mul_pd(_mm512_set1_pd(2.0), _mm512_loadu_pd(in.sigma.data() + i))));
+					__m512d const u = _mm512_mul_pd(_mm512_mul_pd(_mm512_loadu_pd(in.Ep.data() + i), _mm512_mul_pd(D, _mm512_set1_pd(0.5))), logRatio);
+
+					_mm512_storeu_pd(out.waveResistance.data() + i, _mm512_div_pd(_mm512_mul_pd(_mm512_set1_pd(60.0), logRatio), sqrtEpsilon));
+					__m512d const metal = _mm512_div_pd(_mm512_mul_pd(sqrtEpsilon, _mm512_add_pd(_mm512_div_pd(R_superficial, d), _mm512_div_pd(R_superficial, D))),
+						_mm512_mul_pd(_mm512_set1_pd(120.0 * M_PI), logRatio));
+					_mm512_storeu_pd(out.metalAttenuation.data() + i, _mm512_mul_pd(metal, _mm512_set1_pd(8.68)));
+					_mm512_storeu_pd(out.peakPower.data() + i, _mm512_mul_pd(_mm512_div_pd(_mm512_mul_pd(u, u), _mm512_set1_pd(120.0)),
+						_mm512_sqrt_pd(_mm512_div_pd(epsilon, logRatio))));
+				}
+				kernelScalar(in, out, i, n);
+			}
+#endif // COAXIAL_SIMD_X86
+
+			//    ,     
+			isa detect() noexcept {
+#if defined(COAXIAL_SIMD_X86) && defined(_MSC_VER)
+				int info[4];
+				__cpuid(info, 0);
+				int const maxLeaf = info[0];
+				__cpuid(info, 1);
+				bool const sse2 = (info[3] & (1 << 26)) != 0;
+				bool const osxsave = (info[2] & (1 << 27)) != 0;
+				unsigned long long const xcr0 = osxsave ? _xgetbv(0) : 0;
+				bool avx2 = false;
+				bool avx512 = false;
+				if (maxLeaf >= 7) {
+					__cpuidex(info, 7, 0);
+					// YMM  :  1, 2; ZMM :  5, 6, 7
+					avx2 = (info[1] & (1 << 5)) != 0 && (xcr0 & 0x06) == 0x06;
+					avx512 = (info[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+				}
+				if (avx512)
+					return isa::avx512;
+				if (avx2)
+					return isa::avx2;
+				if (sse2)
+					return isa::sse2;
+				return isa::scalar;
+#elif defined(COAXIAL_SIMD_X86)
+				__builtin_cpu_init();
+				if (__builtin_cpu_supports("avx512f"))
+					return isa::avx512;
+				if (__builtin_cpu_supports("avx2"))
+					return isa::avx2;
+				if (__builtin_cpu_supports("sse2"))
+					return isa::sse2;
+				return isa::scalar;
+#else
+				return isa::scalar;
+#endif
+			}
+		}
+
+		//   ,     (  )
+		isa best() noexcept {
+			static isa const value = detail::detect();
+			return value;
+		}
+
+		//       
+		//in -    ( )
+		//out -   (  )
+		//set -  ;     ,  best()
+		void computeUnchecked(Inputs const& in, Outputs const& out, isa set) {
+			std::size_t const n = in.d.size();
+			if (in.D.size() != n || in.frequency.size() != n || in.sigma.size() != n || in.epsilon.size() != n || in.Ep.size() != n)
+				throw exception(L"      ");
+			if (out.waveResistance.size() != n || out.metalAttenuation.size() != n || out.peakPower.size() != n)
+				throw exception(L"      ,    ");
+
+			if (static_cast<int>(set) > static_cast<int>(best()))
+				set = best();
+			switch (set) {
+#ifdef COAXIAL_SIMD_X86
+			case isa::avx512:
+				detail::kernelAvx512(in, out, n);
+				break;
+			case isa::avx2:
+				detail::kernelAvx2(in, out, n);
+				break;
+			case isa::sse2:
+				detail::kernelSse2(in, out, n);
+				break;
+#endif
+			default:
+				detail::kernelScalar(in, out, 0, n);
+				break;
+			}
+		}
+
+		//  ,      
+		//    
+		//      ( batch::compute)
+		//in -    ( )
+		//out -   (  )
+		void compute(Inputs const& in, Outputs const& out) {
+			std::size_t const n = in.d.size();
+			if (in.D.size() == n && in.frequency.size() == n && in.sigma.size() == n && in.epsilon.size() == n && in.Ep.size() == n) {
+				//tanDelta     ,     
+				errorMask any = 0;
+				for (std::size_t i = 0; i < n; ++i)
+					any |= violations(in.d[i], in.D[i], in.frequency[i], in.sigma[i], in.epsilon[i], in.Ep[i], 1.0);
+				if (any != 0) {
+					for (std::size_t i = 0; i < n; ++i) {
+						errorMask const mask = violations(in.d[i], in.D[i], in.frequency[i], in.sigma[i], in.epsilon[i], in.Ep[i], 1.0);
+						if (mask != 0)
+							throw exception(firstError(mask));
+					}
+				}
+			}
+			computeUnchecked(in, out, best());
+		}
+
+#ifdef _DEBUG
+		//  :       evaluate()
+		class testCompute {
+			//       ULP
+			//value -  
+			//expected -  
+			//ulps -     
+			static void checkUlps(double value, double expected, double ulps) {
+				double const delta = abs(value - expected);
+				assert(delta <= ulps * std::numeric_limits<double>::epsilon() * abs(expected));
+			}
+		public:
+			testCompute() {
+				test();
+			}
+
+			static void test() {
+				//:   1 ULP  libm
+				for (double x = 1.0001; x < 1e3; x *= 1.01)
+					checkUlps(detail::log(x), std::log(x), 1.0);
+
+				//        
+				std::size_t const n = 19;
+				double d[n], D[n], frequency[n], sigma[n], epsilon[n], Ep[n];
+				for (std::size_t i = 0; i < n; ++i) {
+					d[i] = 1e-3 + 1e-4 * i;
+					D[i] = d[i] * (1.1 + 0.5 * i);
+					frequency[i] = 1e8 * (i + 1);
+					sigma[i] = 1e7 + 3e6 * i;
+					epsilon[i] = 1.0 + 0.25 * i;
+					Ep[i] = 2e7 + 1e6 * i;
+				}
+				Inputs const in{ d, D, frequency, sigma, epsilon, Ep };
+
+				double reference[3][n];
+				computeUnchecked(in, Outputs{ reference[0], reference[1], reference[2] }, isa::scalar);
+				for (std::size_t i = 0; i < n; ++i) {
+					Results const fused = evaluate(Design{ d[i], D[i], frequency[i], sigma[i], epsilon[i], Ep[i], 1e-4 });
+					checkUlps(reference[0][i], fused.waveResistance, 4.0);
+					checkUlps(reference[1][i], fused.metalAttenuation, 4.0);
+					checkUlps(reference[2][i], fused.peakPower, 4.0);
+				}
+
+				isa const sets[] = { isa::sse2, isa::avx2, isa::avx512 };
+				for (isa const set : sets) {
+					double values[3][n];
+					computeUnchecked(in, Outputs{ values[0], values[1], values[2] }, set);
+					for (std::size_t column = 0; column < 3; ++column)
+						for (std::size_t i = 0; i < n; ++i)
+							assert(values[column][i] == reference[column][i]);
+				}
+			}
+		} test_Compute;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstddef>
+#include <utility>
+
+namespace Coaxial {
+	//     (  std::span  C++20)
+	//T -   (     -  )
+	template<typename T>
+	class span final {
+		//   
+		T* data_;
+		// 
+		std::size_t size_;
+	public:
+		//  
+		constexpr span() noexcept :data_(nullptr), size_(0) {}
+		//     
+		//data -    
+		//size -  
+		constexpr span(T* data, std::size_t size) noexcept :data_(data), size_(size) {}
+		//   
+		template<std::size_t N>
+		constexpr span(T(&array)[N]) noexcept :data_(array), size_(N) {}
+		//      (std::vector, std::array)
+		template<typename Container, typename = decltype(std::declval<Container&>().data())>
+		span(Container& container) noexcept :data_(container.data()), size_(container.size()) {}
+		//  span<U> -> span<U const>
+		template<typename U>
+		constexpr span(span<U> const& other) noexcept :data_(other.data()), size_(other.size()) {}
+
+		constexpr T* data()const noexcept {
+			return data_;
+		}
+		constexpr std::size_t size()const noexcept {
+			return size_;
+		}
+		constexpr bool empty()const noexcept {
+			return size_ == 0;
+		}
+		constexpr T& operator[](std::size_t index)const noexcept {
+			return data_[index];
+		}
+		constexpr T* begin()const noexcept {
+			return data_;
+		}
+		constexpr T* end()const noexcept {
+			return data_ + size_;
+		}
+		// 
+		//offset -   
+		//count -  
+		constexpr span subspan(std::size_t offset, std::size_t count)const noexcept {
+			return span(data_ + offset, count);
+		}
+	};
+}
\ No newline at end of file
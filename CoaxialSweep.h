@@ -0,0 +1,388 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialSpan.h"
+#include <cstdint>
+#include <vector>
+
+//     (  )
+//       .   , log(D/d), sqrt(epsilon)
+//  ,    ,     ,
+//       (1 / f)    (sqrt(f)):
+//  wavelength            = (c / sqrt(epsilon)) / f
+//  dielectricAttenuation = (tanDelta * pi * sqrt(epsilon) / c * 8.68) * f
+//  metalAttenuation      = (sqrt(epsilon) * (1/d + 1/D) * sqrt(pi * mu0 / sigma) / (120 * pi * log(D/d)) * 8.68) * sqrt(f)
+//      ,   .
+//,     (,  ,    ), - . evaluate.
+//adaptiveSweep   :     ,     
+//(   1 ..100    1e-4 -  720      ).
+
+namespace Coaxial {
+	//    ,   -   ,    ,   ( )
+	//Real -      (float, double, long double)
+	template<typename Real>
+	struct basicSweepOutputs {
+		//   , 
+		span<Real> wavelength;
+		//  , /
+		span<Real> dielectricAttenuation;
+		//  , /
+		span<Real> metalAttenuation;
+		// , /
+		span<Real> totalAttenuation;
+	};
+
+	//  -  
+	using SweepOutputs = basicSweepOutputs<double>;
+
+	//,    first  last 
+	//first -  , 
+	//last -  , 
+	//frequencies -   
+	template<typename Real>
+	void linearFrequencies(Real const first, Real const last, span<Real> const frequencies) {
+		if (first <= Real(0) || last < first)
+			throw exception(error::frequency);
+
+		std::size_t const n = frequencies.size();
+		if (n == 0)
+			return;
+		Real const step = n > 1 ? (last - first) / static_cast<Real>(n - 1) : Real(0);
+		for (std::size_t i = 0; i < n; ++i)
+			frequencies[i] = first + step * static_cast<Real>(i);
+		//  - ,   
+		if (n > 1)
+			frequencies[n - 1] = last;
+	}
+
+	//,       first  last 
+	//(   )
+	//first -  , 
+	//last -  , 
+	//frequencies -   
+	template<typename Real>
+	void logarithmicFrequencies(Real const first, Real const last, span<Real> const frequencies) {
+		using std::exp;
+		using std::log;
+		if (first <= Real(0) || last < first)
+			throw exception(error::frequency);
+
+		std::size_t const n = frequencies.size();
+		if (n == 0)
+			return;
+		//   ;     ,   
+		Real const step = n > 1 ? log(last / first) / static_cast<Real>(n - 1) : Real(0);
+		for (std::size_t i = 0; i < n; ++i)
+			frequencies[i] = first * exp(step * static_cast<Real>(i));
+		if (n > 1)
+			frequencies[n - 1] = last;
+	}
+
+	//   ,    
+	//Real -      (float, double, long double)
+	template<typename Real>
+	struct basicSweepTerms {
+		//c / sqrt(epsilon), /
+		Real wavelengthFactor;
+		//tanDelta * pi * sqrt(epsilon) / c * 8.68, /(*)
+		Real dielectricFactor;
+		//     1 , /
+		Real metalFactor;
+
+		//   , 
+		//frequency - , 
+		Real wavelength(Real const frequency)const noexcept {
+			return wavelengthFactor / frequency;
+		}
+		// , /
+		//frequency - , 
+		template<typename Math = exactMath>
+		Real totalAttenuation(Real const frequency)const noexcept {
+			return dielectricFactor * frequency + metalFactor * Math::sqrt(frequency);
+		}
+	};
+
+	//        
+	//Math -    (sqrt, log)
+	//design -   ( frequency  )
+	template<typename Math = exactMath, typename Real>
+	basicSweepTerms<Real> sweepTerms(basicDesign<Real> const& design) noexcept {
+		Real const pi = static_cast<Real>(M_PI);
+		Real const c = static_cast<Real>(lightSpeed);
+		Real const decibels = static_cast<Real>(8.68);
+
+		Real const sqrtEpsilon = Math::sqrt(design.epsilon);
+		Real const logRatio = Math::log(design.D / design.d);
+		basicSweepTerms<Real> terms;
+		terms.wavelengthFactor = c / sqrtEpsilon;
+		terms.dielectricFactor = design.tanDelta * pi * sqrtEpsilon / c * decibels;
+		//R_superficial = sqrt(omega * mu0 / (2 * sigma)) = sqrt(pi * mu0 / sigma) * sqrt(f)
+		terms.metalFactor = sqrtEpsilon * (Real(1) / design.d + Real(1) / design.D) *
+			Math::sqrt(pi * static_cast<Real>(magneticConstant) / design.sigma) / (Real(120) * pi * logRatio) * decibels;
+		return terms;
+	}
+
+	//      (  )
+	//design -  
+	template<typename Real>
+	void validateSweepDesign(basicDesign<Real> const& design) {
+		basicDesign<Real> geometry = design;
+		geometry.frequency = Real(1);
+		errorMask const mask = violations(geometry);
+		if (mask != 0)
+			throw exception(firstError(mask));
+	}
+
+	//      
+	//      (NaN  ),   
+	//Math -    (sqrt, log)
+	//design -   ( frequency  )
+	//frequencies -  , 
+	//out -   (   )
+	template<typename Math = exactMath, typename Real>
+	void sweepFrequencyUnchecked(basicDesign<Real> const& design, span<Real const> const frequencies, basicSweepOutputs<Real> const& out) {
+		std::size_t const n = frequencies.size();
+		span<Real> const columns[] = { out.wavelength, out.dielectricAttenuation, out.metalAttenuation, out.totalAttenuation };
+		for (span<Real> const& column : columns)
+			if (!column.empty() && column.size() != n)
+				throw exception(L"         ,    ");
+
+		//,    
+		basicSweepTerms<Real> const terms = sweepTerms<Math>(design);
+		Real const wavelengthFactor = terms.wavelengthFactor;
+		Real const dielectricFactor = terms.dielectricFactor;
+		Real const metalFactor = terms.metalFactor;
+
+		Real const* __restrict f = frequencies.data();
+		if (!out.wavelength.empty()) {
+			Real* __restrict wavelength = out.wavelength.data();
+			for (std::size_t i = 0; i < n; ++i)
+				wavelength[i] = wavelengthFactor / f[i];
+		}
+		if (!out.dielectricAttenuation.empty()) {
+			Real* __restrict dielectricAttenuation = out.dielectricAttenuation.data();
+			for (std::size_t i = 0; i < n; ++i)
+				dielectricAttenuation[i] = dielectricFactor * f[i];
+		}
+		if (!out.metalAttenuation.empty()) {
+			Real* __restrict metalAttenuation = out.metalAttenuation.data();
+			for (std::size_t i = 0; i < n; ++i)
+				metalAttenuation[i] = metalFactor * Math::sqrt(f[i]);
+		}
+		if (!out.totalAttenuation.empty()) {
+			Real* __restrict totalAttenuation = out.totalAttenuation.data();
+			for (std::size_t i = 0; i < n; ++i)
+				totalAttenuation[i] = dielectricFactor * f[i] + metalFactor * Math::sqrt(f[i]);
+		}
+	}
+
+	//  :           
+	//     ,  -    
+	//Math -    (sqrt, log)
+	//design -   ( frequency  )
+	//frequencies -  , 
+	//out -   (   )
+	template<typename Math = exactMath, typename Real>
+	void sweepFrequency(basicDesign<Real> const& design, span<Real const> const frequencies, basicSweepOutputs<Real> const& out) {
+		validateSweepDesign(design);
+		errorMask invalid = 0;
+		for (Real const frequency : frequencies)
+			invalid |= errorMask(frequency <= Real(0));
+		if (invalid != 0)
+			throw exception(error::frequency);
+		sweepFrequencyUnchecked<Math>(design, frequencies, out);
+	}
+
+	// :   
+	enum class spacing : std::uint8_t {
+		linear,
+		logarithmic
+	};
+
+	//  
+	//Real -      (float, double, long double)
+	template<typename Real>
+	struct basicSweepPoint {
+		//, 
+		Real frequency;
+		// 
+		Real value;
+	};
+
+	//  -  
+	using SweepPoint = basicSweepPoint<double>;
+
+	//    
+	//    ;    ,     
+	//      (   )    tolerance * ||.
+	//      (  ),    function   .
+	//   ,    (  ,  ) .
+	//function - : Real(Real frequency)
+	//first -  , 
+	//last -  , 
+	//tolerance -    
+	//scale -   (  -   )
+	//initialPoints -     (  2;      )
+	//maxPoints -    (     )
+	template<typename Real, typename Function>
+	std::vector<basicSweepPoint<Real>> adaptiveSweep(Function&& function, Real const first, Real const last, Real const tolerance,
+		spacing const scale = spacing::logarithmic, std::size_t const initialPoints = 9, std::size_t const maxPoints = 65536) {
+		using std::sqrt;
+		using std::abs;
+		if (first <= Real(0) || last <= first)
+			throw exception(error::frequency);
+		if (!(tolerance > Real(0)) || initialPoints < 2 || maxPoints < initialPoints)
+			throw exception(L"    0,   -   2     maxPoints");
+
+		std::vector<Real> grid(initialPoints);
+		if (scale == spacing::linear)
+			linearFrequencies(first, last, span<Real>(grid));
+		else
+			logarithmicFrequencies(first, last, span<Real>(grid));
+
+		//,  
+		struct interval {
+			basicSweepPoint<Real> left;
+			basicSweepPoint<Real> right;
+			//  (    )
+			unsigned depth;
+		};
+		constexpr unsigned maxDepth = 48;
+
+		std::vector<basicSweepPoint<Real>> points;
+		points.reserve(initialPoints * 4);
+		std::vector<basicSweepPoint<Real>> coarse(initialPoints);
+		for (std::size_t i = 0; i < initialPoints; ++i)
+			coarse[i] = { grid[i], function(grid[i]) };
+		std::size_t evaluations = initialPoints;
+
+		//    :       
+		std::vector<interval> stack;
+		for (std::size_t i = initialPoints - 1; i > 0; --i)
+			stack.push_back({ coarse[i - 1], coarse[i], 0 });
+		while (!stack.empty()) {
+			interval const current = stack.back();
+			stack.pop_back();
+			Real const a = current.left.frequency;
+			Real const b = current.right.frequency;
+			Real const middle = scale == spacing::linear ? (a + b) / Real(2) : sqrt(a * b);
+			if (evaluations >= maxPoints || current.depth >= maxDepth || !(middle > a && middle < b)) {
+				points.push_back(current.left);
+				continue;
+			}
+
+			basicSweepPoint<Real> const center{ middle, function(middle) };
+			++evaluations;
+			Real const interpolated = (current.left.value + current.right.value) / Real(2);
+			if (abs(center.value - interpolated) <= tolerance * abs(center.value)) {
+				points.push_back(current.left);
+				points.push_back(center);
+				continue;
+			}
+			stack.push_back({ center, current.right, current.depth + 1 });
+			stack.push_back({ current.left, center, current.depth + 1 });
+		}
+		points.push_back(coarse.back());
+		return points;
+	}
+
+	//     (,    ,   )
+	//Math -    (sqrt, log)
+	//design -   ( frequency  )
+	//first -  , 
+	//last -  , 
+	//tolerance -    
+	//scale -  
+	template<typename Math = exactMath, typename Real>
+	std::vector<basicSweepPoint<Real>> adaptiveAttenuationSweep(basicDesign<Real> const& design, Real const first, Real const last,
+		Real const tolerance, spacing const scale = spacing::logarithmic) {
+		validateSweepDesign(design);
+		basicSweepTerms<Real> const terms = sweepTerms<Math>(design);
+		return adaptiveSweep([&terms](Real const frequency) noexcept { return terms.template totalAttenuation<Math>(frequency); },
+			first, last, tolerance, scale);
+	}
+
+#ifdef _DEBUG
+	//   :       
+	class testSweep {
+		//  
+		//value -  
+		//expected -   
+		static void checkClose(double value, double expected) {
+			double const delta = abs(value - expected);
+			assert(delta <= 1e-12 * abs(expected));
+		}
+	public:
+		testSweep() {
+			test();
+		}
+
+		static void test() {
+			double frequencies[31];
+			logarithmicFrequencies(1e6, 1e11, span<double>(frequencies));
+			assert(frequencies[0] == 1e6 && frequencies[30] == 1e11);
+			checkClose(frequencies[6], 1e7);
+
+			double wavelength[31], dielectricAttenuation[31], metalAttenuation[31], totalAttenuation[31];
+			Design design{ 2.1e-3, 7.3e-3, 0.0, 6.1e7, 2.08, 2.5e7, 2.5e-4 };
+			sweepFrequency(design, span<double const>(frequencies),
+				SweepOutputs{ wavelength, dielectricAttenuation, metalAttenuation, totalAttenuation });
+			for (std::size_t i = 0; i < 31; ++i) {
+				design.frequency = frequencies[i];
+				Results const result = evaluate(design);
+				checkClose(wavelength[i], result.wavelength);
+				checkClose(dielectricAttenuation[i], result.dielectricAttenuation);
+				checkClose(metalAttenuation[i], result.metalAttenuation);
+				checkClose(totalAttenuation[i], result.totalAttenuation);
+			}
+
+			//  ;  
+			linearFrequencies(1e9, 2e9, span<double>(frequencies));
+			assert(frequencies[0] == 1e9 && frequencies[30] == 2e9);
+			checkClose(frequencies[15], 1.5e9);
+			sweepFrequency(design, span<double const>(frequencies), SweepOutputs{ {}, {}, {}, totalAttenuation });
+			design.frequency = frequencies[15];
+			checkClose(totalAttenuation[15], evaluate(design).totalAttenuation);
+
+			//   
+			frequencies[7] = 0.0;
+			bool thrown = false;
+			try {
+				sweepFrequency(design, span<double const>(frequencies), SweepOutputs{ {}, {}, {}, totalAttenuation });
+			}
+			catch (exception const& e) {
+				thrown = e.code() == error::frequency;
+			}
+			assert(thrown);
+
+			// :        (  4 )
+			//  ,     
+			design.frequency = 0.0;
+			std::vector<SweepPoint> const adaptive = adaptiveAttenuationSweep(design, 1e6, 1e11, 1e-4);
+			assert(adaptive.front().frequency == 1e6 && adaptive.back().frequency == 1e11);
+			double dense[4001];
+			logarithmicFrequencies(1e6, 1e11, span<double>(dense));
+			std::size_t k = 0;
+			for (double const frequency : dense) {
+				while (adaptive[k + 1].frequency < frequency)
+					++k;
+				SweepPoint const& left = adaptive[k];
+				SweepPoint const& right = adaptive[k + 1];
+				double const t = log(frequency / left.frequency) / log(right.frequency / left.frequency);
+				double const interpolated = left.value + t * (right.value - left.value);
+				design.frequency = frequency;
+				double const exact = evaluate(design).totalAttenuation;
+				assert(abs(interpolated - exact) <= 4e-4 * exact);
+			}
+			assert(adaptive.size() < 4001 / 4);
+
+			//,    :    
+			std::vector<SweepPoint> const step = adaptiveSweep([](double const f) { return f < 1.234e9 ? 1.0 : 2.0; },
+				1e9, 2e9, 1e-3, spacing::linear);
+			std::size_t refined = 0;
+			for (std::size_t i = 1; i < step.size(); ++i)
+				refined += step[i].frequency - step[i - 1].frequency < 1e3;
+			assert(refined > 0 && step.size() < 200);
+		}
+	} test_Sweep;
+#endif // _DEBUG
+}
\ No newline at end of file
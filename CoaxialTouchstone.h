@@ -0,0 +1,392 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialCascade.h"
+#include "CoaxialParallel.h"
+#include "CoaxialSpan.h"
+#include <algorithm>
+#include <charconv>
+#include <complex>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//      Touchstone (.s2p)  1.1  2.0
+//  std::to_chars ( ,   ,     )
+//   ;      ,       
+// ,   .            .
+//writeSweep          ,       .
+//  (10^6  RI      ,   operator<<  setprecision(17)) - 
+//benchmarks.cpp ( CoaxialBenchmarks);          .
+
+namespace Coaxial {
+	namespace touchstone {
+		// 
+		enum class version : std::uint8_t {
+			//Touchstone 1.1:    
+			v1,
+			//Touchstone 2.0:   [Version], [Number of Ports], [Number of Frequencies]  ..
+			v2
+		};
+
+		//  
+		enum class format : std::uint8_t {
+			//    (RI)
+			realImaginary,
+			//     (MA)
+			magnitudeAngle,
+			//   (20 * lg)     (DB)
+			decibelAngle
+		};
+
+		// 
+		struct settings {
+			// 
+			touchstone::version version = version::v1;
+			//  
+			touchstone::format format = format::realImaginary;
+			//  (0 -  ,   )
+			int precision = 0;
+			//  , 
+			std::size_t bufferSize = 1 << 16;
+			//    (   '!',   -  )
+			std::string comment;
+		};
+
+		//    
+		//   ,      
+		//Real -      (float, double, long double)
+		template<typename Real>
+		class basicWriter {
+			//   : 9   64   
+			static constexpr std::size_t lineCapacity = 9 * 64 + 16;
+
+			// 
+			std::ostream& stream_;
+			// 
+			settings options_;
+			//  
+			std::size_t points_;
+			// 
+			std::size_t written_;
+			// 
+			std::vector<char> buffer_;
+			//  
+			std::size_t used_;
+			// 
+			bool finished_;
+
+			//    
+			void flush() {
+				if (used_ == 0)
+					return;
+				stream_.write(buffer_.data(), static_cast<std::streamsize>(used_));
+				used_ = 0;
+				if (!stream_)
+					throw exception(L"   Touchstone");
+			}
+
+			//   
+			//text - 
+			//length -  
+			void append(char const* const text, std::size_t const length) {
+				if (buffer_.size() - used_ < length) {
+					flush();
+					if (length > buffer_.size()) {
+						stream_.write(text, static_cast<std::streamsize>(length));
+						if (!stream_)
+							throw exception(L"   Touchstone");
+						return;
+					}
+				}
+				std::memcpy(buffer_.data() + used_, text, length);
+				used_ += length;
+			}
+			void append(std::string const& text) {
+				append(text.data(), text.size());
+			}
+
+			//  (     64 )
+			//out -  
+			//value - 
+			//separated -    
+			//     
+			char* number(char* out, Real const value, bool const separated = true) const noexcept {
+				if (separated)
+					*out++ = ' ';
+				return (options_.precision > 0 ?
+					std::to_chars(out, out + 63, value, std::chars_format::general, options_.precision) :
+					std::to_chars(out, out + 63, value)).ptr;
+			}
+
+			//     
+			//out -  
+			//value - 
+			char* number(char* out, std::complex<Real> const value) const noexcept {
+				using std::abs;
+				using std::arg;
+				using std::log10;
+				Real const degrees = static_cast<Real>(180.0 / M_PI);
+				switch (options_.format) {
+				case format::magnitudeAngle:
+					out = number(out, abs(value));
+					return number(out, arg(value) * degrees);
+				case format::decibelAngle:
+					out = number(out, Real(20) * log10(abs(value)));
+					return number(out, arg(value) * degrees);
+				default:
+					out = number(out, value.real());
+					return number(out, value.imag());
+				}
+			}
+
+			//    (     lineCapacity )
+			//out -  
+			//frequency - , 
+			//s -  
+			char* line(char* out, Real const frequency, cascade::basicSParameters<Real> const& s) const noexcept {
+				out = number(out, frequency, false);
+				out = number(out, s.s11);
+				out = number(out, s.s21);
+				out = number(out, s.s12);
+				out = number(out, s.s22);
+				*out++ = '\n';
+				return out;
+			}
+		public:
+			//:     
+			//stream -   (   ,     '\n'  )
+			//points -  ,   
+			//impedance -  , 
+			//options -  
+			basicWriter(std::ostream& stream, std::size_t const points, Real const impedance, settings const& options = settings()) :
+				stream_(stream), options_(options), points_(points), written_(0), used_(0), finished_(false) {
+				if (!(impedance > Real(0)))
+					throw exception(error::impedance);
+				if (options.precision < 0 || options.precision > 40)
+					throw exception(L"      0  40");
+				if (options.bufferSize < lineCapacity)
+					throw exception(L"       ");
+				buffer_.resize(options.bufferSize);
+
+				// - ,    '!'
+				std::size_t begin = 0;
+				while (begin < options.comment.size()) {
+					std::size_t end = options.comment.find('\n', begin);
+					if (end == std::string::npos)
+						end = options.comment.size();
+					append("! ", 2);
+					append(options.comment.data() + begin, end - begin);
+					append("\n", 1);
+					begin = end + 1;
+				}
+
+				if (options.version == version::v2)
+					append("[Version] 2.0\n");
+				static char const* const formats[] = { "RI", "MA", "DB" };
+				append("# HZ S ");
+				append(formats[static_cast<std::size_t>(options.format)]);
+				append(" R", 2);
+				char text[64];
+				append(text, static_cast<std::size_t>(number(text, impedance) - text));
+				append("\n", 1);
+				if (options.version == version::v2) {
+					append("[Number of Ports] 2\n[Two-Port Data Order] 21_12\n[Number of Frequencies] ");
+					append(std::to_string(points));
+					append("\n[Network Data]\n");
+				}
+			}
+
+			basicWriter(basicWriter const&) = delete;
+			basicWriter& operator=(basicWriter const&) = delete;
+
+			//:  ,         (  - finish)
+			~basicWriter() {
+				try {
+					flush();
+				}
+				catch (...) {
+				}
+			}
+
+			//   (: S11 S21 S12 S22)
+			//frequency - , 
+			//s -  
+			void write(Real const frequency, cascade::basicSParameters<Real> const& s) {
+				if (finished_ || written_ == points_)
+					throw exception(L"  ,  ");
+				if (buffer_.size() - used_ < lineCapacity)
+					flush();
+				used_ = static_cast<std::size_t>(line(buffer_.data() + used_, frequency, s) - buffer_.data());
+				++written_;
+			}
+
+			//  
+			//        partLines ,   
+			//        (  ,    )
+			//frequencies - , 
+			//s -  ,   
+			//threads -    (0 -    )
+			void write(span<Real const> const frequencies, span<cascade::basicSParameters<Real> const> const s, unsigned threads = 1) {
+				constexpr std::size_t partLines = 1024;
+				std::size_t const n = frequencies.size();
+				if (s.size() != n)
+					throw exception(L"         ");
+				if (finished_ || n > points_ - written_)
+					throw exception(L"  ,  ");
+				threads = parallel::threadCount(threads, (n + partLines - 1) / partLines);
+				if (threads == 1) {
+					for (std::size_t i = 0; i < n; ++i)
+						write(frequencies[i], s[i]);
+					return;
+				}
+
+				//   -  4  ,  - partLines * lineCapacity  
+				std::size_t const group = 4 * static_cast<std::size_t>(threads);
+				std::vector<std::vector<char>> parts(group, std::vector<char>(partLines * lineCapacity));
+				std::vector<std::size_t> lengths(group);
+				for (std::size_t begin = 0; begin < n; begin += group * partLines) {
+					std::size_t const count = std::min(group, (n - begin + partLines - 1) / partLines);
+					parallel::forEach(count, threads, [&](std::size_t const part) {
+						std::size_t const first = begin + part * partLines, last = std::min(n, first + partLines);
+						char* out = parts[part].data();
+						for (std::size_t i = first; i < last; ++i)
+							out = line(out, frequencies[i], s[i]);
+						lengths[part] = static_cast<std::size_t>(out - parts[part].data());
+					});
+					for (std::size_t part = 0; part < count; ++part)
+						append(parts[part].data(), lengths[part]);
+				}
+				written_ += n;
+			}
+
+			// :   , [End]   2.0,   
+			void finish() {
+				if (finished_)
+					return;
+				if (written_ != points_)
+					throw exception(L"  ,  ");
+				if (options_.version == version::v2)
+					append("[End]\n");
+				flush();
+				stream_.flush();
+				finished_ = true;
+				if (!stream_)
+					throw exception(L"   Touchstone");
+			}
+		};
+
+		//  -  
+		using Writer = basicWriter<double>;
+
+		//       Touchstone:        
+		//stream -  
+		//run - 
+		//frequencies - , 
+		//impedance -  , 
+		//options -  
+		//threads -      (0 -    )
+		//block -    
+		template<typename Real>
+		void writeSweep(std::ostream& stream, cascade::basicRun<Real> const& run, span<Real const> const frequencies, Real const impedance,
+			settings const& options = settings(), unsigned const threads = 0, std::size_t const block = 4096) {
+			if (block == 0)
+				throw exception(L"     0");
+			cascade::validateFrequencies(frequencies);
+			basicWriter<Real> writer(stream, frequencies.size(), impedance, options);
+			std::vector<cascade::basicSParameters<Real>> s(std::min(block, frequencies.size()));
+			for (std::size_t begin = 0; begin < frequencies.size(); begin += block) {
+				std::size_t const count = std::min(block, frequencies.size() - begin);
+				span<Real const> const part = frequencies.subspan(begin, count);
+				span<cascade::basicSParameters<Real>> const result(s.data(), count);
+				cascade::scattering(run, part, impedance, result, threads);
+				writer.write(part, span<cascade::basicSParameters<Real> const>(result), threads);
+			}
+			writer.finish();
+		}
+
+#ifdef _DEBUG
+		//  Touchstone:          
+		class testTouchstone {
+		public:
+			testTouchstone() {
+				test();
+			}
+
+			static void test() {
+				cascade::Segment const segment{ 1e-3, 3.5e-3, 5.8e7, 2.08, 2.5e-4, 12.5 };
+				cascade::Run const run(span<cascade::Segment const>(&segment, 1));
+				double const frequencies[] = { 1e6, 3.3e8, 1.2e10 };
+				cascade::SParameters expected[3];
+				cascade::scattering(run, span<double const>(frequencies), 50.0, span<cascade::SParameters>(expected), 1);
+
+				// 1.1, RI:       9 ,   
+				std::ostringstream first;
+				settings options;
+				options.comment = "Coaxial cable\n12.5 m";
+				writeSweep(first, run, span<double const>(frequencies), 50.0, options, 1, 2);
+				std::istringstream input(first.str());
+				std::string line;
+				std::getline(input, line);
+				assert(line == "! Coaxial cable");
+				std::getline(input, line);
+				assert(line == "! 12.5 m");
+				std::getline(input, line);
+				assert(line == "# HZ S RI R 50");
+				for (std::size_t i = 0; i < 3; ++i) {
+					double values[9];
+					for (double& value : values)
+						input >> value;
+					assert(values[0] == frequencies[i]);
+					assert(values[1] == expected[i].s11.real() && values[2] == expected[i].s11.imag());
+					assert(values[3] == expected[i].s21.real() && values[4] == expected[i].s21.imag());
+					assert(values[7] == expected[i].s22.real() && values[8] == expected[i].s22.imag());
+				}
+				input >> line;
+				assert(input.eof());
+
+				// 2.0, DB:  ,  S21 -     
+				std::ostringstream second;
+				options = settings();
+				options.version = version::v2;
+				options.format = format::decibelAngle;
+				options.precision = 12;
+				options.bufferSize = 1024;
+				writeSweep(second, run, span<double const>(frequencies), 50.0, options);
+				std::string const text = second.str();
+				assert(text.compare(0, 14, "[Version] 2.0\n") == 0);
+				assert(text.find("# HZ S DB R 50\n[Number of Ports] 2\n[Two-Port Data Order] 21_12\n[Number of Frequencies] 3\n[Network Data]\n") != std::string::npos);
+				assert(text.size() > 6 && text.compare(text.size() - 6, 6, "[End]\n") == 0);
+				std::istringstream data(text.substr(text.find("[Network Data]\n") + 15));
+				double values[9];
+				for (double& value : values)
+					data >> value;
+				assert(abs(values[3] - 20.0 * log10(abs(expected[0].s21))) <= 1e-10);
+
+				//     
+				std::vector<double> many(3000);
+				logarithmicFrequencies(1e6, 2e10, span<double>(many));
+				std::ostringstream serial, parallel;
+				writeSweep(serial, run, span<double const>(many), 50.0, settings(), 1, 2500);
+				writeSweep(parallel, run, span<double const>(many), 50.0, settings(), 3, 2500);
+				assert(serial.str() == parallel.str());
+
+				//     
+				std::ostringstream third;
+				Writer writer(third, 1, 50.0);
+				writer.write(frequencies[0], expected[0]);
+				bool thrown = false;
+				try {
+					writer.write(frequencies[1], expected[1]);
+				}
+				catch (exception const&) {
+					thrown = true;
+				}
+				assert(thrown);
+				writer.finish();
+			}
+		} test_Touchstone;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
@@ -0,0 +1,383 @@
+#pragma once
+#include "Coaxial.h"
+#include "CoaxialCascade.h"
+#include "CoaxialParallel.h"
+#include "CoaxialSpan.h"
+#include "CoaxialSweep.h"
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+//       (   )
+//    L    L / phaseSpeed:
+//  H(f) = exp(-L * (alphaD * f + (1 + j) * alphaM * sqrt(f))),
+// alphaD * f  alphaM * sqrt(f) -      (sweepTerms),   /  /.
+//    - -   :   R(1 + j) 
+//    ,     (  erfc(a / (2 * sqrt(t))),
+//a = alphaM * L / sqrt(pi)).      tanDelta   ,   
+//Coaxial.h;         (    samples * timeStep).
+//  f_k = k / (samples * timeStep), k = 0..samples/2,    :     
+// ,     samples/2         ( 
+//    2      ).   .
+//     ( L / phaseSpeed),      
+//( -    t^(-3/2)).
+// (65536 , 16 ,      ;     ) -  benchmarks.cpp
+//( CoaxialBenchmarks).
+
+namespace Coaxial {
+	namespace transient {
+		//     ( -  ,   4)
+		//: X[k] = sum x[n] * exp(-2 * pi * j * k * n / N), k = 0..N/2 ( - )
+		//: x[n] = 1 / N * sum X[k] * exp(2 * pi * j * k * n / N)
+		//Real -      (float, double, long double)
+		template<typename Real>
+		class basicFft {
+			//  
+			std::size_t size_;
+			//      M: exp(-2 * pi * j * i / M), i = 0..M/2-1
+			std::vector<std::complex<Real>> twiddles_;
+			//     : exp(-2 * pi * j * k / N), k = 0..M
+			std::vector<std::complex<Real>> rotations_;
+			//      M
+			std::vector<std::size_t> reversed_;
+
+			//   M    
+			//data - 
+			//inverse -  ( )
+			void transform(std::complex<Real>* const data, bool const inverse) const noexcept {
+				std::size_t const m = size_ / 2;
+				for (std::size_t i = 0; i < m; ++i)
+					if (i < reversed_[i])
+						std::swap(data[i], data[reversed_[i]]);
+				Real const sign = inverse ? Real(-1) : Real(1);
+				for (std::size_t length = 2; length <= m; length *= 2) {
+					std::size_t const half = length / 2, stride = m / length;
+					for (std::size_t begin = 0; begin < m; begin += length)
+						for (std::size_t j = 0; j < half; ++j) {
+							//   - ,   std::complex  
+							std::complex<Real> const w = twiddles_[j * stride];
+							Real const wr = w.real(), wi = sign * w.imag();
+							std::complex<Real>& a = data[begin + j];
+							std::complex<Real>& b = data[begin + j + half];
+							Real const vr = b.real() * wr - b.imag() * wi;
+							Real const vi = b.real() * wi + b.imag() * wr;
+							b = { a.real() - vr, a.imag() - vi };
+							a = { a.real() + vr, a.imag() + vi };
+						}
+				}
+			}
+		public:
+			//
+			//size -    ( ,   4)
+			explicit basicFft(std::size_t const size) :size_(size) {
+				using std::cos;
+				using std::sin;
+				if (size < 4 || (size & (size - 1)) != 0)
+					throw exception(L"         4");
+				std::size_t const m = size / 2;
+				long double const pi = 3.141592653589793238462643383279502884L;
+				twiddles_.resize(m / 2);
+				for (std::size_t i = 0; i < m / 2; ++i) {
+					long double const angle = -2 * pi * static_cast<long double>(i) / static_cast<long double>(m);
+					twiddles_[i] = { static_cast<Real>(cos(angle)), static_cast<Real>(sin(angle)) };
+				}
+				rotations_.resize(m + 1);
+				for (std::size_t k = 0; k <= m; ++k) {
+					long double const angle = -2 * pi * static_cast<long double>(k) / static_cast<long double>(size);
+					rotations_[k] = { static_cast<Real>(cos(angle)), static_cast<Real>(sin(angle)) };
+				}
+				reversed_.resize(m);
+				std::size_t bits = 0;
+				while ((std::size_t(1) << bits) < m)
+					++bits;
+				for (std::size_t i = 0; i < m; ++i) {
+					std::size_t r = 0;
+					for (std::size_t b = 0; b < bits; ++b)
+						r |= ((i >> b) & 1) << (bits - 1 - b);
+					reversed_[i] = r;
+				}
+			}
+
+			//  
+			std::size_t size() const noexcept {
+				return size_;
+			}
+
+			// 
+			//input - , size() 
+			//spectrum - , size() / 2 + 1 
+			void forward(Real const* const input, std::complex<Real>* const spectrum) const noexcept {
+				std::size_t const m = size_ / 2;
+				//׸  -  ,  - 
+				for (std::size_t i = 0; i < m; ++i)
+					spectrum[i] = { input[2 * i], input[2 * i + 1] };
+				transform(spectrum, false);
+				spectrum[m] = spectrum[0];
+				//X[k] = E[k] + W^k * O[k], E = (Z[k] + conj(Z[M-k])) / 2, O = (Z[k] - conj(Z[M-k])) / 2j;  k  M-k - 
+				for (std::size_t k = 0; k <= m / 2; ++k) {
+					std::complex<Real> const z = spectrum[k], mirror = std::conj(spectrum[m - k]);
+					std::complex<Real> const even = (z + mirror) * Real(0.5);
+					std::complex<Real> const odd = (z - mirror) * std::complex<Real>(Real(0), Real(-0.5));
+					std::complex<Real> const z2 = spectrum[m - k], mirror2 = std::conj(spectrum[k]);
+					std::complex<Real> const even2 = (z2 + mirror2) * Real(0.5);
+					std::complex<Real> const odd2 = (z2 - mirror2) * std::complex<Real>(Real(0), Real(-0.5));
+					spectrum[k] = even + rotations_[k] * odd;
+					spectrum[m - k] = even2 + rotations_[m - k] * odd2;
+				}
+			}
+
+			//  ( 1 / N)
+			//spectrum - X[k], k = 0..size() / 2 ()
+			//output - , size() 
+			void inverse(std::complex<Real>* const spectrum, Real* const output) const noexcept {
+				std::size_t const m = size_ / 2;
+				//Z[k] = E[k] + j * O[k], E = (X[k] + conj(X[M-k])) / 2, O = (X[k] - conj(X[M-k])) * conj(W^k) / 2
+				for (std::size_t k = 0; k <= m / 2; ++k) {
+					std::complex<Real> const x = spectrum[k], mirror = std::conj(spectrum[m - k]);
+					std::complex<Real> const x2 = spectrum[m - k], mirror2 = std::conj(spectrum[k]);
+					std::complex<Real> const even = (x + mirror) * Real(0.5);
+					std::complex<Real> const odd = (x - mirror) * std::conj(rotations_[k]) * Real(0.5);
+					std::complex<Real> const even2 = (x2 + mirror2) * Real(0.5);
+					std::complex<Real> const odd2 = (x2 - mirror2) * std::conj(rotations_[m - k]) * Real(0.5);
+					spectrum[k] = even + std::complex<Real>(-odd.imag(), odd.real());
+					spectrum[m - k] = even2 + std::complex<Real>(-odd2.imag(), odd2.real());
+				}
+				transform(spectrum, true);
+				Real const scale = Real(1) / static_cast<Real>(m);
+				for (std::size_t i = 0; i < m; ++i) {
+					output[2 * i] = spectrum[i].real() * scale;
+					output[2 * i + 1] = spectrum[i].imag() * scale;
+				}
+			}
+		};
+
+		// :    -   samples  (  -   * samples)
+		//   
+		//Real -      (float, double, long double)
+		template<typename Real>
+		struct basicResponseOutputs {
+			// , 1/
+			span<Real> impulse;
+			//  (    )
+			span<Real> step;
+			//  L / phaseSpeed, ,    
+			span<Real> delay;
+		};
+
+		//          
+		//Real -      (float, double, long double)
+		template<typename Real>
+		class basicResponse {
+			// 
+			basicFft<Real> fft_;
+			//  , 
+			Real timeStep_;
+			// , /
+			Real phaseSpeed_;
+			//    1    , /
+			std::vector<Real> attenuation_;
+			//    1  (-), /
+			std::vector<Real> phase_;
+		public:
+			//
+			//design -    ( frequency  )
+			//samples -   ( ,   4)
+			//timeStep -   , 
+			basicResponse(basicDesign<Real> const& design, std::size_t const samples, Real const timeStep) :fft_(samples), timeStep_(timeStep) {
+				using std::sqrt;
+				validateSweepDesign(design);
+				if (!(timeStep > Real(0)))
+					throw exception(L"      0");
+
+				basicSweepTerms<Real> const terms = sweepTerms(design);
+				phaseSpeed_ = terms.wavelengthFactor;
+				Real const nepers = static_cast<Real>(M_LN10 / 20.0);
+				Real const frequencyStep = Real(1) / (static_cast<Real>(samples) * timeStep);
+				attenuation_.resize(samples / 2 + 1);
+				phase_.resize(samples / 2 + 1);
+				for (std::size_t k = 0; k <= samples / 2; ++k) {
+					Real const frequency = frequencyStep * static_cast<Real>(k);
+					Real const skin = terms.metalFactor * sqrt(frequency) * nepers;
+					attenuation_[k] = terms.dielectricFactor * frequency * nepers + skin;
+					phase_[k] = skin;
+				}
+			}
+
+			// 
+			std::size_t samples() const noexcept {
+				return fft_.size();
+			}
+			//  , 
+			Real timeStep() const noexcept {
+				return timeStep_;
+			}
+
+			//   length   
+			//length -  , 
+			//spectrum - , samples() / 2 + 1 
+			void transfer(Real const length, std::complex<Real>* const spectrum) const noexcept {
+				using std::exp;
+				using std::cos;
+				using std::sin;
+				std::size_t const m = fft_.size() / 2;
+				for (std::size_t k = 0; k <= m; ++k) {
+					Real const magnitude = exp(-length * attenuation_[k]);
+					Real const angle = length * phase_[k];
+					spectrum[k] = { magnitude * cos(angle), -magnitude * sin(angle) };
+				}
+				//      
+				spectrum[m] = { std::abs(spectrum[m]), Real(0) };
+			}
+
+			//   
+			//lengths -  , 
+			//out -  
+			//threads -   (0 -    )
+			void compute(span<Real const> const lengths, basicResponseOutputs<Real> const& out, unsigned const threads = 0) const {
+				std::size_t const n = samples();
+				std::size_t const count = lengths.size();
+				if ((!out.impulse.empty() && out.impulse.size() != count * n) || (!out.step.empty() && out.step.size() != count * n))
+					throw exception(L"       ,    ");
+				if (!out.delay.empty() && out.delay.size() != count)
+					throw exception(L"       ");
+				bool valid = true;
+				for (Real const length : lengths)
+					valid &= length > Real(0);
+				if (!valid)
+					throw exception(error::length);
+
+				for (std::size_t i = 0; i < out.delay.size(); ++i)
+					out.delay[i] = lengths[i] / phaseSpeed_;
+				if (out.impulse.empty() && out.step.empty())
+					return;
+				parallel::forEach(count, threads, [&](std::size_t const i) {
+					std::vector<std::complex<Real>> spectrum(n / 2 + 1);
+					std::vector<Real> buffer;
+					Real* impulse = out.impulse.empty() ? nullptr : out.impulse.data() + i * n;
+					if (impulse == nullptr) {
+						buffer.resize(n);
+						impulse = buffer.data();
+					}
+					transfer(lengths[i], spectrum.data());
+					fft_.inverse(spectrum.data(), impulse);
+					//   -     1 / (n * timeStep): h = x / timeStep
+					Real const scale = Real(1) / timeStep_;
+					for (std::size_t j = 0; j < n; ++j)
+						impulse[j] *= scale;
+					if (!out.step.empty()) {
+						//  -    (  timeStep)
+						Real* const step = out.step.data() + i * n;
+						Real sum = 0;
+						for (std::size_t j = 0; j < n; ++j) {
+							sum += impulse[j] * timeStep_;
+							step[j] = sum;
+						}
+					}
+				});
+			}
+		};
+
+		//     10  90%   ( ), 
+		//  - ,     
+		//step -  
+		//timeStep -   , 
+		template<typename Real>
+		Real riseTime(span<Real const> const step, Real const timeStep) {
+			if (step.size() < 2)
+				throw exception(L"       ");
+			Real const final = step[step.size() - 1];
+			//   
+			auto const crossing = [&](Real const level) {
+				for (std::size_t j = 1; j < step.size(); ++j)
+					if (step[j] >= level && step[j - 1] < level)
+						return (static_cast<Real>(j - 1) + (level - step[j - 1]) / (step[j] - step[j - 1])) * timeStep;
+				return step[0] >= level ? Real(0) : static_cast<Real>(step.size() - 1) * timeStep;
+			};
+			return crossing(Real(0.9) * final) - crossing(Real(0.1) * final);
+		}
+
+		//  -  
+		using Fft = basicFft<double>;
+		using ResponseOutputs = basicResponseOutputs<double>;
+		using Response = basicResponse<double>;
+
+#ifdef _DEBUG
+		// :    , -  erfc,    
+		class testTransient {
+		public:
+			testTransient() {
+				test();
+			}
+
+			static void test() {
+				//       
+				std::size_t const size = 64;
+				Fft const fft(size);
+				std::vector<double> signal(size), restored(size);
+				for (std::size_t i = 0; i < size; ++i)
+					signal[i] = sin(0.3 * static_cast<double>(i * i)) + 0.1 * static_cast<double>(i % 5);
+				std::vector<std::complex<double>> spectrum(size / 2 + 1);
+				fft.forward(signal.data(), spectrum.data());
+				for (std::size_t k = 0; k <= size / 2; ++k) {
+					std::complex<double> sum = 0;
+					for (std::size_t i = 0; i < size; ++i)
+						sum += signal[i] * std::polar(1.0, -2 * M_PI * static_cast<double>(k * i) / static_cast<double>(size));
+					assert(abs(spectrum[k] - sum) <= 1e-12 * static_cast<double>(size));
+				}
+				fft.inverse(spectrum.data(), restored.data());
+				for (std::size_t i = 0; i < size; ++i)
+					assert(abs(restored[i] - signal[i]) <= 1e-13);
+
+				//    :   - h(t) = a / (2 * sqrt(pi)) * t^(-3/2) * exp(-a^2 / (4t)),
+				//a = alphaM * L / sqrt(pi);    -   h(t + p * T)   p >= 0, T = samples * timeStep
+				Design const design{ 0.5e-3, 1.75e-3, 0, 5.8e7, 2.1, 1.0, 1e-12 };
+				double const timeStep = 1e-12;
+				std::size_t const samples = 1 << 16;
+				Response const response(design, samples, timeStep);
+				double const lengths[] = { 50.0, 200.0, 400.0 };
+				std::vector<double> impulse(3 * samples), step(3 * samples), delay(3);
+				response.compute(span<double const>(lengths), ResponseOutputs{ impulse, step, delay }, 2);
+				double const nepers = M_LN10 / 20.0;
+				double const period = static_cast<double>(samples) * timeStep;
+				for (std::size_t i = 0; i < 3; ++i) {
+					double const a = sweepTerms(design).metalFactor * nepers * lengths[i] / sqrt(M_PI);
+					auto const h = [a](double const t) {
+						return a / (2 * sqrt(M_PI)) * exp(-a * a / (4 * t)) / (t * sqrt(t));
+					};
+					for (std::size_t j : { 2000, 10000, 30000, 60000 }) {
+						double const t = static_cast<double>(j) * timeStep;
+						double expected = 0;
+						std::size_t const terms = 20000;
+						for (std::size_t p = 0; p <= terms; ++p)
+							expected += h(t + static_cast<double>(p) * period);
+						//  - : sum (pT)^(-3/2)  p > P ~ 2 / sqrt(P + 1/2) * T^(-3/2)
+						expected += a / (2 * sqrt(M_PI)) * 2 / sqrt(terms + 0.5) / (period * sqrt(period));
+						assert(abs(impulse[i * samples + j] - expected) <= 1e-6 * expected);
+					}
+					//    - H(0) = 1
+					assert(abs(step[i * samples + samples - 1] - 1) <= 1e-12);
+					assert(abs(delay[i] - lengths[i] * sqrt(design.epsilon) / lightSpeed) <= 1e-15 * delay[i]);
+				}
+				//  -: erfc(a / (2 * sqrt(t))) = 0.1  0.9  t = a^2 / 5.41  31.6 * a^2 (  L^2);
+				// 10 ,    
+				Response const coarse(design, samples, 1e-11);
+				double const shortLengths[] = { 10.0, 20.0 };
+				std::vector<double> shortSteps(2 * samples);
+				coarse.compute(span<double const>(shortLengths), ResponseOutputs{ {}, shortSteps, {} });
+				for (std::size_t i = 0; i < 2; ++i) {
+					double const a = sweepTerms(design).metalFactor * nepers * shortLengths[i] / sqrt(M_PI);
+					double const x10 = 1.1630871536766743, x90 = 0.088855990494257687;
+					double const expected = a * a / 4 * (1 / (x90 * x90) - 1 / (x10 * x10));
+					double const rise = riseTime(span<double const>(shortSteps.data() + i * samples, samples), 1e-11);
+					assert(abs(rise - expected) <= 0.05 * expected);
+				}
+
+				//  -   
+				std::vector<double> serial(3 * samples);
+				response.compute(span<double const>(lengths), ResponseOutputs{ serial, {}, {} }, 1);
+				assert(serial == impulse);
+			}
+		} test_Transient;
+#endif // _DEBUG
+	}
+}
\ No newline at end of file
@@ -61,28 +61,27 @@ void CoaxialCalculator::MainPage::ButtonStart_Click(Platform::Object^ sender, Wi
 		//Тангенс угла потерь
 		double const tanDelta = ToDouble(TextBox_tanDelta->Text);
 
+		//Все величины рассчитываются за один проход с общей проверкой исходных данных
+		Coaxial::Results const result = Coaxial::evaluate(Coaxial::Design{ d, D, f, sigma, epsilon, Ep, tanDelta });
+
 		//Длина волны
-		double const lambda = Coaxial::wavelengthInTheLine(f, epsilon);//м
-		double const lambda_output = lambda * 1e3;//мм
+		double const lambda_output = result.wavelength * 1e3;//мм
 		//Фазовая скорость
-		double const vfl = Coaxial::phaseSpeed(epsilon);//м/с
-		double const vfl_output = vfl * 1e-3;//км/с
+		double const vfl_output = result.phaseSpeed * 1e-3;//км/с
 		//Характеристическое сопротивление, Ом
-		double const zc = Coaxial::characteristicResistance(epsilon);
+		double const zc = result.characteristicResistance;
 		//Затухание в диэлектрике, дБ/м
-		double const alpha_d = Coaxial::attenuationCoefficientInDielectric(tanDelta, lambda);
+		double const alpha_d = result.dielectricAttenuation;
 		//Затухание в металле, дБ/м
-		double const alpha_m = Coaxial::attenuationCoefficientInMetal(f, sigma, epsilon, d, D);
+		double const alpha_m = result.metalAttenuation;
 		//Общее затухание, дБ/м
-		double const alpha = Coaxial::totalAttenuationCoefficient(tanDelta, f, sigma, epsilon, d, D);
+		double const alpha = result.totalAttenuation;
 		//Волновое сопротивление, Ом
-		double const rho = Coaxial::waveResistance(epsilon, d, D);
+		double const rho = result.waveResistance;
 		//Пиковое напряжение
-		double const Umax = Coaxial::peakVoltage(Ep, d, D);//В
-		double const Umax_output = Umax * 1e-3;//кВ
+		double const Umax_output = result.peakVoltage * 1e-3;//кВ
 		//Пиковая мощность
-		double const Pmax = Coaxial::peakPower(epsilon, Ep, d, D);//Вт
-		double const Pmax_output = Pmax * 1e-6;//МВт
+		double const Pmax_output = result.peakPower * 1e-6;//МВт
 
 		//..Вывод результатов расчётов
 		TextBlock_lambda->Text = lambda_output.ToString();
@@ -0,0 +1,612 @@
+// 
+// ,      (  ,  ).
+//   -     ;   ,    :
+//     ,       .
+//: CMake- CoaxialBenchmarks (-O3 -fno-math-errno,   -  COAXIAL_BENCHMARK_ARCH,
+//  -march=native;         gather, . CoaxialLookup.h);
+// MSVC -  Release.    -   ,
+//--quick -      (   ctest,     ).
+//    inline        .
+
+#include "Coaxial.h"
+#include "CoaxialSpan.h"
+#include "CoaxialParallel.h"
+#include "CoaxialBatch.h"
+#include "CoaxialSimd.h"
+#include "CoaxialConstexpr.h"
+#include "CoaxialFast.h"
+#include "CoaxialSweep.h"
+#include "CoaxialDielectric.h"
+#include "CoaxialLookup.h"
+#include "CoaxialGrid.h"
+#include "CoaxialCascade.h"
+#include "CoaxialTransient.h"
+#include "CoaxialTouchstone.h"
+#include "CoaxialCache.h"
+#include "CoaxialGraph.h"
+#include "CoaxialPareto.h"
+#include "CoaxialMonteCarlo.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+namespace {
+	//     
+	bool quick = false;
+	// :      
+	volatile double sink = 0.0;
+
+	//     , 
+	//repetitions -   ( --quick - )
+	//body -  
+	template<typename Body>
+	double measure(int const repetitions, Body const& body) {
+		double best = std::numeric_limits<double>::infinity();
+		for (int repetition = 0; repetition < (quick ? 1 : repetitions); ++repetition) {
+			auto const start = std::chrono::steady_clock::now();
+			body();
+			std::chrono::duration<double, std::micro> const elapsed = std::chrono::steady_clock::now() - start;
+			best = std::min(best, elapsed.count());
+		}
+		return best;
+	}
+
+	//       (    )
+	//body -     
+	template<typename Body>
+	void threadRuns(Body const& body) {
+		unsigned const all = std::max(1u, std::thread::hardware_concurrency());
+		body(1u);
+		if (all > 1)
+			body(all);
+		else
+			std::puts("  (one hardware thread: no parallel run)");
+	}
+
+	//: libm, ,   SIMD-  , 4096  D/d  1.1-10
+	void logarithms() {
+		constexpr std::size_t n = 4096;
+		std::vector<double> ratio(n), result(n);
+		for (std::size_t i = 0; i < n; ++i)
+			ratio[i] = 1.1 + 8.9 * static_cast<double>(i) / (n - 1);
+
+		auto const run = [&](char const* const name, auto const& log) {
+			double const time = measure(2000, [&]() {
+				double const* __restrict x = ratio.data();
+				double* __restrict y = result.data();
+				for (std::size_t i = 0; i < n; ++i)
+					y[i] = log(x[i]);
+				sink = sink + y[n / 2];
+			});
+			std::printf("  %-20s %9.2f us %8.2f ns/value\n", name, time, time * 1e3 / n);
+		};
+		std::puts("log, 4096 values of D/d in [1.1, 10]:");
+		run("std::log", [](double const x) { return std::log(x); });
+		run("lookup::log", [](double const x) { return Coaxial::lookup::log(x); });
+		run("simd::detail::log", [](double const x) { return Coaxial::simd::detail::log(x); });
+		run("fast::log", [](double const x) { return Coaxial::fast::log(x); });
+	}
+
+	//  :   D/d  1.1-10   
+	class batchData {
+		// : d, D, frequency, sigma, epsilon, Ep, tanDelta
+		std::vector<double> inputs_[7];
+		// (  )
+		std::vector<double> outputs_[9];
+		//  TE11    
+		std::vector<double> cutoff_;
+		std::vector<std::uint8_t> singleMode_;
+	public:
+		//
+		//n -  
+		explicit batchData(std::size_t const n) {
+			for (std::vector<double>& column : inputs_)
+				column.resize(n);
+			for (std::vector<double>& column : outputs_)
+				column.resize(n);
+			cutoff_.resize(n);
+			singleMode_.resize(n);
+			for (std::size_t i = 0; i < n; ++i) {
+				double const t = static_cast<double>(i) / static_cast<double>(n);
+				inputs_[0][i] = 1e-3 * (1.0 + (i % 7) * 0.25);
+				inputs_[1][i] = inputs_[0][i] * (1.1 + 8.9 * t);
+				inputs_[2][i] = 1e9 * (1.0 + (i % 13));
+				inputs_[3][i] = 5.8e7 - 1e6 * (i % 5);
+				inputs_[4][i] = 2.0 + 0.1 * (i % 11);
+				inputs_[5][i] = 2.5e7 + 1e6 * (i % 3);
+				inputs_[6][i] = 2e-4 + 1e-5 * (i % 4);
+			}
+		}
+
+		// 
+		std::size_t size() const noexcept {
+			return inputs_[0].size();
+		}
+		//  
+		Coaxial::batch::Inputs inputs() const noexcept {
+			return { inputs_[0], inputs_[1], inputs_[2], inputs_[3], inputs_[4], inputs_[5], inputs_[6] };
+		}
+		// 
+		//modes -        
+		Coaxial::batch::Outputs outputs(bool const modes) noexcept {
+			return { outputs_[0], outputs_[1], outputs_[2], outputs_[3], outputs_[4], outputs_[5], outputs_[6], outputs_[7], outputs_[8],
+				modes ? Coaxial::span<double>(cutoff_) : Coaxial::span<double>(), modes ? Coaxial::span<std::uint8_t>(singleMode_) : Coaxial::span<std::uint8_t>() };
+		}
+		//   ( )
+		double checksum() const noexcept {
+			return outputs_[5][size() / 2] + outputs_[8][size() / 3];
+		}
+	};
+
+	//    Math, 
+	//data - 
+	//modes -        
+	//repetitions -  
+	template<typename Math>
+	double batchTime(batchData& data, bool const modes, int const repetitions = 500) {
+		Coaxial::batch::Inputs const in = data.inputs();
+		Coaxial::batch::Outputs const out = data.outputs(modes);
+		double const time = measure(repetitions, [&]() {
+			Coaxial::batch::computeUnchecked<Math>(in, out);
+		});
+		sink = sink + data.checksum();
+		return time;
+	}
+
+	//   
+	//name - 
+	//time - , 
+	//rows -  
+	void printBatch(char const* const name, double const time, std::size_t const rows) {
+		std::printf("  %-20s %9.2f us %8.1f M rows/s\n", name, time, static_cast<double>(rows) / time);
+	}
+
+	//            
+	//(simd::computeUnchecked    ,   log(D/d):  ,   ,
+	// , -     ,    simd::detail::log  logarithms)
+	void batches() {
+		batchData data(4096);
+		std::puts("batch::computeUnchecked, 4096 rows, nine columns:");
+		printBatch("exactMath", batchTime<Coaxial::exactMath>(data, false), data.size());
+		printBatch("lookup::math", batchTime<Coaxial::lookup::math>(data, false), data.size());
+		printBatch("fast::math", batchTime<Coaxial::fast::math>(data, false), data.size());
+
+		using Coaxial::simd::isa;
+		isa const set = Coaxial::simd::best();
+		char const* const names[] = { "scalar", "sse2", "avx2", "avx512" };
+		Coaxial::batch::Inputs const in = data.inputs();
+		Coaxial::batch::Outputs const out = data.outputs(false);
+		Coaxial::simd::Inputs const simdIn{ in.d, in.D, in.frequency, in.sigma, in.epsilon, in.Ep };
+		Coaxial::simd::Outputs const simdOut{ out.waveResistance, out.metalAttenuation, out.peakPower };
+		double const time = measure(500, [&]() {
+			Coaxial::simd::computeUnchecked(simdIn, simdOut, set);
+		});
+		sink = sink + data.checksum();
+		std::printf("simd::computeUnchecked (%s), 4096 rows, three columns:\n", names[static_cast<int>(set)]);
+		printBatch("simd", time, data.size());
+	}
+
+	//   TE11        , 2^20  (  L2)
+	void cutoffColumns() {
+		batchData data(quick ? 4096 : std::size_t(1) << 20);
+		std::printf("batch::computeUnchecked, %zu rows, without / with TE11 cutoff and single-mode columns:\n", data.size());
+		printBatch("exactMath", batchTime<Coaxial::exactMath>(data, false, 20), data.size());
+		printBatch("exactMath + TE11", batchTime<Coaxial::exactMath>(data, true, 20), data.size());
+		printBatch("fast::math", batchTime<Coaxial::fast::math>(data, false, 20), data.size());
+		printBatch("fast::math + TE11", batchTime<Coaxial::fast::math>(data, true, 20), data.size());
+	}
+
+	//  (   ):    
+	void singles() {
+		batchData data(quick ? 256 : 4096);
+		Coaxial::batch::Inputs const in = data.inputs();
+		std::vector<Coaxial::Design> designs(data.size());
+		for (std::size_t i = 0; i < designs.size(); ++i)
+			designs[i] = { in.d[i], in.D[i], in.frequency[i], in.sigma[i], in.epsilon[i], in.Ep[i], in.tanDelta[i] };
+
+		auto const run = [&](char const* const name, auto const& evaluate) {
+			double const time = measure(500, [&]() {
+				double total = 0.0;
+				for (Coaxial::Design const& design : designs)
+					total += evaluate(design).totalAttenuation;
+				sink = sink + total;
+			});
+			printBatch(name, time, designs.size());
+		};
+		std::printf("evaluate, %zu designs one by one:\n", designs.size());
+		run("Coaxial::evaluate", [](Coaxial::Design const& design) { return Coaxial::evaluate(design); });
+		run("fast::evaluate", [](Coaxial::Design const& design) { return Coaxial::fast::evaluate(design); });
+	}
+
+	//  :       - , 4096  100  - 40 ,  
+	template<typename Math>
+	void dielectricSweep(char const* const policy) {
+		using namespace Coaxial;
+		constexpr std::size_t n = 4096;
+		double const first = 1e8, last = 4e10;
+		std::vector<double> frequencies(n), columns[4];
+		for (std::vector<double>& column : columns)
+			column.resize(n);
+		logarithmicFrequencies(first, last, span<double>(frequencies));
+		SweepOutputs const out{ columns[0], columns[1], columns[2], columns[3] };
+		Design const design{ 2.1e-3, 7.3e-3, 0.0, 5.8e7, 2.08, 2.5e7, 2.5e-4 };
+		dielectric::Table const ptfe(dielectric::DjordjevicSarkar::fit(2.08, 2.5e-4, 1e10), 1e7, 1e11);
+
+		double const constant = measure(2000, [&]() {
+			sweepFrequencyUnchecked<Math>(design, span<double const>(frequencies), out);
+			sink = sink + columns[3][n / 2];
+		});
+		double const list = measure(2000, [&]() {
+			dielectric::sweepFrequencyUnchecked<Math>(design, ptfe, span<double const>(frequencies), out);
+			sink = sink + columns[3][n / 2];
+		});
+		double const grid = measure(2000, [&]() {
+			dielectric::sweepLogarithmicUnchecked<Math>(design, ptfe, first, last, span<double const>(frequencies), out);
+			sink = sink + columns[3][n / 2];
+		});
+		std::printf("frequency sweep, %s, 4096 log-spaced points 100 MHz - 40 GHz, four columns:\n", policy);
+		std::printf("  %-34s %9.2f us\n", "constant epsilon", constant);
+		std::printf("  %-34s %9.2f us %6.2fx\n", "dielectric table, frequency list", list, list / constant);
+		std::printf("  %-34s %9.2f us %6.2fx\n", "dielectric table, logarithmic grid", grid, grid / constant);
+	}
+
+	//      :  4096 x 4096,  ,      
+	void gridMaps() {
+		std::size_t const n = quick ? 256 : 4096;
+		std::vector<double> d(n), D(n), waveResistance(n * n), metalAttenuation(n * n);
+		for (std::size_t i = 0; i < n; ++i) {
+			double const t = static_cast<double>(i) / static_cast<double>(n - 1);
+			d[i] = 0.5e-3 + 4.5e-3 * t;
+			D[i] = 1e-3 + 29e-3 * t;
+		}
+		Coaxial::grid::Outputs const out{ waveResistance, metalAttenuation };
+		std::printf("grid::compute, %zu x %zu cells, both maps:\n", n, n);
+		threadRuns([&](unsigned const threads) {
+			Coaxial::grid::tiling tiles;
+			tiles.threads = threads;
+			double const time = measure(10, [&]() {
+				Coaxial::grid::compute(Coaxial::span<double const>(d), Coaxial::span<double const>(D), 1e9, 5.8e7, 2.08, out, tiles);
+				sink = sink + waveResistance[n * n / 2];
+			});
+			std::printf("  %2u thread(s) %12.3f ms %8.1f M cells/s\n", threads, time * 1e-3, static_cast<double>(n * n) / time);
+		});
+	}
+
+	// :  10^4   1000       ,      
+	void cascadeRun() {
+		using namespace Coaxial::cascade;
+		std::size_t const count = quick ? 1000 : 10000;
+		std::size_t const points = quick ? 20 : 1000;
+		//      (, , )
+		std::vector<Segment> segments(count);
+		for (std::size_t k = 0; k < count; ++k)
+			segments[k] = { 2.1e-3 + 0.1e-3 * (k % 3), 7.3e-3 + 0.2e-3 * (k % 5), 5.8e7, 2.08 + 0.02 * (k % 7), 2.5e-4, 0.5 + 0.1 * (k % 11) };
+		Run const run{ Coaxial::span<Segment const>(segments) };
+		std::vector<double> frequencies(points), insertionLoss(points), returnLoss(points);
+		Coaxial::logarithmicFrequencies(1e6, 1e10, Coaxial::span<double>(frequencies));
+		LinkOutputs const out{ insertionLoss, returnLoss };
+		std::vector<Abcd> prefixes(count);
+
+		std::printf("cascade, %zu segments: sweep over %zu frequencies, prefix at one frequency:\n", count, points);
+		threadRuns([&](unsigned const threads) {
+			double const sweepTime = measure(3, [&]() {
+				sweep(run, Coaxial::span<double const>(frequencies), 50.0, out, threads);
+				sink = sink + insertionLoss[points / 2];
+			});
+			double const prefixTime = measure(100, [&]() {
+				prefix(run, 1e9, Coaxial::span<Abcd>(prefixes), threads);
+				sink = sink + prefixes[count / 2].A.real();
+			});
+			std::printf("  %2u thread(s) sweep %10.3f ms %8.1f ns/segment/frequency, prefix %9.3f ms\n", threads, sweepTime * 1e-3,
+				sweepTime * 1e3 / (static_cast<double>(count) * points), prefixTime * 1e-3);
+		});
+	}
+
+	// : 65536 , 16 ,    ,      ;
+	//    -        
+	void transientResponses() {
+		using namespace Coaxial::transient;
+		std::size_t const samples = quick ? 4096 : 65536;
+		std::size_t const count = quick ? 4 : 16;
+		Response const response(Coaxial::Design{ 2.1e-3, 7.3e-3, 1e9, 5.8e7, 2.08, 2.5e7, 2.5e-4 }, samples, 1e-11);
+		std::vector<double> lengths(count), impulse(count * samples), step(count * samples);
+		for (std::size_t i = 0; i < count; ++i)
+			lengths[i] = 10.0 * static_cast<double>(i + 1);
+		ResponseOutputs const out{ impulse, step, {} };
+
+		std::printf("transient::Response::compute, %zu samples, %zu lengths, impulse and step:\n", samples, count);
+		threadRuns([&](unsigned const threads) {
+			double const time = measure(10, [&]() {
+				response.compute(Coaxial::span<double const>(lengths), out, threads);
+				sink = sink + step[samples / 2];
+			});
+			std::printf("  %2u thread(s) %10.3f ms %8.3f ms/length\n", threads, time * 1e-3, time * 1e-3 / static_cast<double>(count));
+		});
+
+		std::vector<std::complex<double>> spectrum(samples / 2 + 1);
+		std::vector<double> output(samples);
+		double const transfer = measure(100, [&]() {
+			response.transfer(100.0, spectrum.data());
+			sink = sink + spectrum[samples / 4].real();
+		});
+		Fft const fft(samples);
+		double const inverse = measure(100, [&]() {
+			response.transfer(100.0, spectrum.data());
+			fft.inverse(spectrum.data(), output.data());
+			sink = sink + output[samples / 2];
+		});
+		std::printf("  one length: transfer function %8.3f ms, with inverse FFT %8.3f ms\n", transfer * 1e-3, inverse * 1e-3);
+	}
+
+	// ,      (     )
+	class discardBuffer final : public std::streambuf {
+		// 
+		std::uint64_t bytes_ = 0;
+	protected:
+		std::streamsize xsputn(char const* const, std::streamsize const count) override {
+			bytes_ += static_cast<std::uint64_t>(count);
+			return count;
+		}
+		int_type overflow(int_type const ch) override {
+			++bytes_;
+			return traits_type::not_eof(ch);
+		}
+	public:
+		// 
+		std::uint64_t bytes() const noexcept {
+			return bytes_;
+		}
+		// 
+		void reset() noexcept {
+			bytes_ = 0;
+		}
+	};
+
+	// Touchstone: 10^6  RI  Writer::write            operator<<  setprecision(17)
+	void touchstoneWriting() {
+		using namespace Coaxial;
+		std::size_t const points = quick ? 10000 : 1000000;
+		std::vector<double> frequencies(points);
+		std::vector<cascade::SParameters> s(points);
+		for (std::size_t i = 0; i < points; ++i) {
+			double const f = 1e6 + 1e4 * static_cast<double>(i);
+			std::complex<double> const transmission = std::polar(std::exp(-2e-11 * f), -2.1e-8 * f);
+			std::complex<double> const reflection = std::polar(1e-3 * (1.0 + std::sin(1e-9 * f)), 7e-9 * f);
+			frequencies[i] = f;
+			s[i] = { reflection, transmission, transmission, reflection };
+		}
+		discardBuffer buffer;
+		std::ostream stream(&buffer);
+
+		auto const print = [&](char const* const name, double const time) {
+			std::printf("  %-28s %10.1f ms %8.1f MB/s\n", name, time * 1e-3, static_cast<double>(buffer.bytes()) / time);
+		};
+		std::printf("touchstone, %zu RI lines into a discarding stream:\n", points);
+		threadRuns([&](unsigned const threads) {
+			double const time = measure(5, [&]() {
+				buffer.reset();
+				touchstone::Writer writer(stream, points, 50.0);
+				writer.write(span<double const>(frequencies), span<cascade::SParameters const>(s), threads);
+				writer.finish();
+			});
+			char name[32];
+			std::snprintf(name, sizeof name, "Writer::write, %u thread(s)", threads);
+			print(name, time);
+		});
+		// :     ,      
+		double const time = measure(1, [&]() {
+			buffer.reset();
+			stream << std::setprecision(17);
+			for (std::size_t i = 0; i < points; ++i) {
+				stream << frequencies[i];
+				for (std::complex<double> const value : { s[i].s11, s[i].s21, s[i].s12, s[i].s22 })
+					stream << ' ' << value.real() << ' ' << value.imag();
+				stream << '\n';
+			}
+			stream.flush();
+		});
+		print("operator<<, setprecision(17)", time);
+	}
+
+	// :     64  ,  (  ,  )  evaluate  ,
+	//        ;  -     
+	template<typename Real>
+	void cacheLookups(char const* const type) {
+		using Design = Coaxial::basicDesign<Real>;
+		std::size_t const calls = quick ? 1000 : 200000;
+		std::vector<Design> hot(64);
+		for (std::size_t k = 0; k < hot.size(); ++k)
+			hot[k] = { Real(0.5e-3) * (1 + k % 4), Real(3.5e-3) + Real(1e-4) * k, Real(1e9), Real(5.8e7), Real(2.08), Real(2.5e7), Real(2.5e-4) };
+		Coaxial::cache::basicCache<Real> cache;
+		for (Design const& design : hot)
+			cache.evaluate(design);
+		std::atomic<std::uint64_t> fresh(0);
+
+		std::printf("cache::Cache<%s>, 64 hot keys, per call of one thread:\n", type);
+		threadRuns([&](unsigned const threads) {
+			auto const time = [&](auto const& call) {
+				return measure(5, [&]() {
+					Coaxial::parallel::run(threads, [&](unsigned const t) {
+						Real total = 0;
+						for (std::size_t i = 0; i < calls; ++i)
+							total += call(t, i).totalAttenuation;
+						sink = sink + static_cast<double>(total);
+					});
+				}) * 1e3 / static_cast<double>(calls);
+			};
+			double const hit = time([&](unsigned const t, std::size_t const i) {
+				return cache.evaluate(hot[(i + 17 * t) % hot.size()]);
+			});
+			double const miss = time([&](unsigned, std::size_t const i) {
+				Design design = hot[i % hot.size()];
+				design.frequency += Real(++fresh);
+				return cache.evaluate(design);
+			});
+			double const direct = time([&](unsigned const t, std::size_t const i) {
+				return Coaxial::evaluate(hot[(i + 17 * t) % hot.size()]);
+			});
+			std::printf("  %2u thread(s) hit %7.1f ns, miss %7.1f ns, Coaxial::evaluate %7.1f ns\n", threads, hit, miss, direct);
+		});
+	}
+
+	// :         (results)   (get totalAttenuation)
+	// evaluate    ;  -   
+	void graphEdits() {
+		using namespace Coaxial::graph;
+		std::size_t const edits = quick ? 1000 : 1000000;
+		Coaxial::Design const base{ 2.1e-3, 7.3e-3, 1e9, 5.8e7, 2.08, 2.5e7, 2.5e-4 };
+		// ,  Design    
+		struct edit {
+			char const* name;
+			input in;
+			double Coaxial::Design::* field;
+			double values[2];
+		};
+		edit const cases[] = {
+			{ "d", input::d, &Coaxial::Design::d, { 2.1e-3, 2.2e-3 } },
+			{ "D", input::D, &Coaxial::Design::D, { 7.3e-3, 7.4e-3 } },
+			{ "frequency", input::frequency, &Coaxial::Design::frequency, { 1e9, 2e9 } },
+			{ "sigma", input::sigma, &Coaxial::Design::sigma, { 5.8e7, 6.1e7 } },
+			{ "epsilon", input::epsilon, &Coaxial::Design::epsilon, { 2.08, 2.1 } },
+			{ "Ep", input::Ep, &Coaxial::Design::Ep, { 2.5e7, 2.6e7 } },
+			{ "tanDelta", input::tanDelta, &Coaxial::Design::tanDelta, { 2.5e-4, 3e-4 } }
+		};
+
+		std::printf("graph, %zu single-input edits, per edit:\n", edits);
+		std::printf("  %-10s %16s %16s %20s\n", "input", "set + results", "set + get", "Coaxial::evaluate");
+		for (edit const& c : cases) {
+			Graph graph(base);
+			double const all = measure(5, [&]() {
+				double total = 0.0;
+				for (std::size_t i = 0; i < edits; ++i) {
+					graph.set(c.in, c.values[i & 1]);
+					total += graph.results().totalAttenuation;
+				}
+				sink = sink + total;
+			}) * 1e3 / static_cast<double>(edits);
+			double const one = measure(5, [&]() {
+				double total = 0.0;
+				for (std::size_t i = 0; i < edits; ++i) {
+					graph.set(c.in, c.values[i & 1]);
+					total += graph.get(output::totalAttenuation);
+				}
+				sink = sink + total;
+			}) * 1e3 / static_cast<double>(edits);
+			Coaxial::Design design = base;
+			double const direct = measure(5, [&]() {
+				double total = 0.0;
+				for (std::size_t i = 0; i < edits; ++i) {
+					design.*c.field = c.values[i & 1];
+					total += Coaxial::evaluate(design).totalAttenuation;
+				}
+				sink = sink + total;
+			}) * 1e3 / static_cast<double>(edits);
+			std::printf("  %-10s %13.1f ns %13.1f ns %17.1f ns\n", c.name, all, one, direct);
+		}
+	}
+
+	// :  (  )      
+	// 2.1/7.3 , epsilon 2.08,   0.02 , 0.05 , 0.04, 5*10^6 /;  - 51.3..52.3 .
+	// -          32  (seed 1..32)
+	//  (, 2^24 ).
+	void toleranceSampling() {
+		using namespace Coaxial::montecarlo;
+		Coaxial::Design const nominal{ 2.1e-3, 7.3e-3, 1e9, 5.8e7, 2.08, 2.5e7, 2.5e-4 };
+		Tolerances const tolerances{ 0.02e-3, 0.05e-3, 0.04, 5e6 };
+		Limits limits;
+		limits.impedanceMin = 51.3;
+		limits.impedanceMax = 52.3;
+		sampling const methods[] = { sampling::random, sampling::sobol, sampling::latinHypercube };
+
+		settings throughput;
+		throughput.samples = quick ? 1 << 16 : 1 << 22;
+		throughput.threads = 1;
+		std::printf("montecarlo::analyze, one thread, %llu samples:\n", static_cast<unsigned long long>(throughput.samples));
+		for (sampling const method : methods) {
+			throughput.method = method;
+			double const time = measure(3, [&]() {
+				sink = sink + analyze(nominal, tolerances, limits, throughput).yield();
+			});
+			std::printf("  %-16s %10.1f ms %8.2f M samples/s\n", method == sampling::random ? "random" : method == sampling::sobol ? "sobol" : "latinHypercube",
+				time * 1e-3, static_cast<double>(throughput.samples) / time);
+		}
+
+		settings reference;
+		reference.samples = quick ? 1 << 16 : 1 << 24;
+		reference.method = sampling::sobol;
+		Report const exact = analyze(nominal, tolerances, limits, reference);
+		unsigned const replicates = quick ? 4 : 32;
+		std::printf("montecarlo::measureConvergence, %u replicates, error of mean impedance (Ohm) / yield:\n", replicates);
+		std::printf("  %8s %21s %21s %21s\n", "samples", "random", "sobol", "latinHypercube");
+		for (std::uint64_t samples = 1024; samples <= (quick ? 4096u : 65536u); samples *= 4) {
+			std::printf("  %8llu", static_cast<unsigned long long>(samples));
+			for (sampling const method : methods) {
+				settings trial;
+				trial.samples = samples;
+				trial.seed = 1;
+				trial.method = method;
+				convergence const errors = measureConvergence(nominal, tolerances, limits, trial, exact, replicates);
+				std::printf("    %8.1e / %8.1e", errors.waveResistance, errors.yield);
+			}
+			std::puts("");
+		}
+	}
+
+	//  : 1000 d x 1000 D x 10  (10^7 )       
+	void paretoFront() {
+		using namespace Coaxial::pareto;
+		std::size_t const sizes = quick ? 100 : 1000;
+		std::vector<double> d(sizes), D(sizes);
+		for (std::size_t i = 0; i < sizes; ++i) {
+			double const t = static_cast<double>(i) / static_cast<double>(sizes - 1);
+			d[i] = 0.5e-3 + 4.5e-3 * t;
+			D[i] = 1e-3 + 29e-3 * t;
+		}
+		//,          
+		Material const materials[] = { { 5.8e7, 2.08, 2.5e7, 2.5e-4 }, { 5.8e7, 2.25, 2.0e7, 3e-4 }, { 5.8e7, 1.5, 1.2e7, 1e-4 },
+			{ 5.8e7, 2.2, 2.2e7, 5e-4 }, { 6.1e7, 2.1, 2.5e7, 2e-4 }, { 6.1e7, 1.1, 3e6, 1e-5 }, { 3.5e7, 2.25, 2.0e7, 3e-4 },
+			{ 3.5e7, 4.5, 1.5e7, 2e-3 }, { 5.8e7, 9.8, 1.3e7, 1e-4 }, { 6.1e7, 3.0, 1.8e7, 1e-3 } };
+		Problem const problem{ d, D, materials, 1e9, 50.0 };
+		std::uint64_t const total = std::uint64_t(sizes) * sizes * (sizeof materials / sizeof materials[0]);
+
+		std::printf("pareto::explore, %zu d x %zu D x %zu materials:\n", sizes, sizes, sizeof materials / sizeof materials[0]);
+		threadRuns([&](unsigned const threads) {
+			std::size_t front = 0;
+			double const time = measure(3, [&]() {
+				front = explore(problem, threads).size();
+			});
+			std::printf("  %2u thread(s) %12.3f s %8.1f M candidates/s, front %zu\n", threads, time * 1e-6, static_cast<double>(total) / time, front);
+		});
+	}
+}
+
+int main(int const argc, char** const argv) {
+	for (int i = 1; i < argc; ++i)
+		quick |= std::strcmp(argv[i], "--quick") == 0;
+
+	logarithms();
+	batches();
+	cutoffColumns();
+	singles();
+	dielectricSweep<Coaxial::exactMath>("exactMath");
+	dielectricSweep<Coaxial::fast::math>("fast::math");
+	gridMaps();
+	cascadeRun();
+	transientResponses();
+	touchstoneWriting();
+	cacheLookups<double>("double");
+	cacheLookups<long double>("long double");
+	graphEdits();
+	toleranceSampling();
+	paretoFront();
+	return 0;
+}
\ No newline at end of file
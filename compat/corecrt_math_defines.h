@@ -0,0 +1,6 @@
+#pragma once
+//  MSVC   GCC  Clang (CMake- CoaxialTests  CoaxialBenchmarks)
+//M_PI     <cmath> ( POSIX); abs(double)   ,
+//  ,  MSVC  ,  -  std
+#include <cmath>
+using std::abs;
\ No newline at end of file
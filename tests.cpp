@@ -0,0 +1,42 @@
+// 
+//     (_DEBUG)      test_...,  
+//   assert   .      ,
+//    main;   assert  .
+//: CMake- CoaxialTests ( - ctest)   CoaxialTests.vcxproj ( Debug).
+//    inline        ,
+//    ,     MainPage.xaml.cpp.
+
+#ifndef _DEBUG
+#error     _DEBUG (CMake    CoaxialTests,  MSVC -  Debug)
+#endif
+#undef NDEBUG
+
+#include "Coaxial.h"
+#include "CoaxialSpan.h"
+#include "CoaxialParallel.h"
+#include "CoaxialBatch.h"
+#include "CoaxialSimd.h"
+#include "CoaxialConstexpr.h"
+#include "CoaxialFast.h"
+#include "CoaxialSweep.h"
+#include "CoaxialGrid.h"
+#include "CoaxialParameterSpace.h"
+#include "CoaxialInverse.h"
+#include "CoaxialPareto.h"
+#include "CoaxialDual.h"
+#include "CoaxialMonteCarlo.h"
+#include "CoaxialInterval.h"
+#include "CoaxialDielectric.h"
+#include "CoaxialCascade.h"
+#include "CoaxialTouchstone.h"
+#include "CoaxialTransient.h"
+#include "CoaxialCache.h"
+#include "CoaxialLookup.h"
+#include "CoaxialGraph.h"
+#include <cstdio>
+
+int main() {
+	//     test_...   
+	std::puts("Coaxial: all self-tests passed");
+	return 0;
+}
\ No newline at end of file